@@ -0,0 +1,135 @@
+﻿/*
+    Copyright (c) 2021 jdeokkim
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "raylib.h"
+#include "lowel.h"
+
+/* 게임 맵의 가로 및 세로 청크 개수 (2의 거듭제곱) */
+#define MAP_SIZE_C 64
+
+/* 청크의 가로 및 세로 타일 개수 */
+#define CHUNK_SIZE_T 16
+
+/* 타일의 가로 및 세로 길이 (픽셀) */
+#define TILE_SIZE 16
+
+/* 좌표 변환을 반복할 횟수 */
+#define ROUND_COUNT 64
+
+/* 측정 결과가 최적화로 사라지지 않도록 값을 모아두는 변수 */
+static volatile long sink;
+
+/* 현재 시각을 초 단위로 반환한다. */
+static double GetSeconds(void) {
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return ts.tv_sec + (ts.tv_nsec * 1e-9);
+}
+
+/* 게임 맵의 모든 청크와 타일의 고유 번호를 좌표로 변환하고, 한 번의 변환에 걸린 시간 (ns)을 반환한다. */
+static double MeasureConversions(LwMap *map) {
+    Vector2 position;
+    
+    double begin, elapsed;
+    
+    long result = 0, count = 0;
+    
+    begin = GetSeconds();
+    
+    for (int r = 0; r < ROUND_COUNT; r++) {
+        for (int i = 0; i < (map->width.c * map->height.c); i++) {
+            position = ChunkIndexToPositionMap(map, i);
+            
+            result += GetMapChunkX(map, i) + GetMapChunkY(map, i) + (long) position.x;
+        }
+        
+        for (int i = 0; i < (map->width.t * map->height.t); i++)
+            result += GetMapTileX(map, i) + GetMapTileY(map, i);
+        
+        count += (map->width.c * map->height.c) + (map->width.t * map->height.t);
+    }
+    
+    elapsed = GetSeconds() - begin;
+    
+    sink = result;
+    
+    return (elapsed * 1e9) / count;
+}
+
+int main(void) {
+    LwMap map = { 0 };
+    LwMapUnit width_shift;
+    
+    char map_data[1024];
+    
+    double shifted, divided;
+    
+    SetTraceLogLevel(LOG_WARNING);
+    
+    snprintf(
+        map_data, 
+        sizeof(map_data),
+        "{ \"header\": { \"name\": \"bench\", \"format_version\": \"1.0.0\" }, "
+        "\"options\": { \"width\": %d, \"height\": %d, \"tile_width\": %d, \"tile_height\": %d, "
+        "\"chunk_width_t\": %d, \"chunk_height_t\": %d, \"draw_distance_c\": 1 }, "
+        "\"layers\": [] }",
+        MAP_SIZE_C * CHUNK_SIZE_T * TILE_SIZE,
+        MAP_SIZE_C * CHUNK_SIZE_T * TILE_SIZE,
+        TILE_SIZE,
+        TILE_SIZE,
+        CHUNK_SIZE_T,
+        CHUNK_SIZE_T
+    );
+    
+    if (!LoadMapFromMemory(&map, map_data)) {
+        fprintf(stderr, "chunk_bench: unable to load map data\n");
+        
+        return 1;
+    }
+    
+    width_shift = map._width_shift;
+    
+    /* 처음 한 번은 캐시를 채우기 위해 실행하고, 결과는 버린다. */
+    MeasureConversions(&map);
+    
+    shifted = MeasureConversions(&map);
+    
+    /* 시프트 값을 지우면 같은 게임 맵에서 나눗셈을 사용하는 경로로 바뀐다. */
+    map._width_shift = (LwMapUnit) { 0 };
+    
+    divided = MeasureConversions(&map);
+    
+    map._width_shift = width_shift;
+    
+    printf("map: %dx%d chunks, %dx%d tiles\n", map.width.c, map.height.c, map.width.t, map.height.t);
+    printf("shift/mask: %6.2f ns per conversion\n", shifted);
+    printf("division:   %6.2f ns per conversion\n", divided);
+    
+    UnloadMap(&map);
+    
+    return 0;
+}
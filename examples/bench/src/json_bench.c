@@ -0,0 +1,239 @@
+﻿/*
+    Copyright (c) 2021 jdeokkim
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "json.h"
+
+#define DEFAULT_MAP_PATH "../bermuda/res/maps/non_tiled.json"
+
+/* `json.c`와 같은 조건으로, 공백과 문자열을 검색할 때 SSE2 명령어를 사용하는지 확인한다. */
+#if !defined(JSON_NO_SSE2) \
+    && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SCANNER_NAME "sse2"
+#else
+#define SCANNER_NAME "scalar"
+#endif
+
+/* 한 번의 측정에 사용할 최소 시간 (초) */
+#define MIN_DURATION 0.5
+
+/* 생성할 게임 맵의 가로 및 세로 타일 개수 */
+#define SYNTHETIC_MAP_SIZE 2048
+
+/* 현재 시각을 초 단위로 반환한다. */
+static double GetSeconds(void) {
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return ts.tv_sec + (ts.tv_nsec * 1e-9);
+}
+
+/* 파일 `file_path`의 내용을 모두 읽어서 반환한다. */
+static char *ReadFileText(const char *file_path, size_t *length) {
+    FILE *file = fopen(file_path, "rb");
+    
+    char *result;
+    
+    long size;
+    
+    if (file == NULL)
+        return NULL;
+    
+    fseek(file, 0, SEEK_END);
+    
+    size = ftell(file);
+    
+    fseek(file, 0, SEEK_SET);
+    
+    result = (char *) malloc(size + 1);
+    
+    *length = fread(result, 1, size, file);
+    result[*length] = '\0';
+    
+    fclose(file);
+    
+    return result;
+}
+
+/* 가로 및 세로 `size`개의 타일로 이루어진, 들여쓰기된 게임 맵 데이터를 만든다. */
+static char *GenerateMapText(int size, size_t *length) {
+    size_t capacity = (size_t) size * size * 8 + 4096;
+    
+    char *result = (char *) malloc(capacity);
+    
+    size_t offset = 0;
+    
+    offset += sprintf(
+        result + offset,
+        "{\n"
+        "    \"header\": {\n"
+        "        \"name\": \"synthetic\",\n"
+        "        \"format_version\": \"1.0.0\"\n"
+        "    },\n"
+        "    \"options\": {\n"
+        "        \"width\": %d,\n"
+        "        \"height\": %d,\n"
+        "        \"tile_width\": 16,\n"
+        "        \"tile_height\": 16,\n"
+        "        \"chunk_width_t\": 16,\n"
+        "        \"chunk_height_t\": 16,\n"
+        "        \"draw_distance_c\": 1\n"
+        "    },\n"
+        "    \"layers\": [\n"
+        "        {\n"
+        "            \"id\": 0,\n"
+        "            \"static\": true,\n"
+        "            \"objects\": [\n"
+        "                {\n"
+        "                    \"id\": 0,\n"
+        "                    \"image\": \"res/images/tileset.png\",\n"
+        "                    \"tileset\": true,\n"
+        "                    \"auto_split\": false,\n"
+        "                    \"scale_mul\": 1.0,\n"
+        "                    \"rotation_deg\": 0.0,\n"
+        "                    \"position\": { \"x\": 0, \"y\": 0 },\n"
+        "                    \"tiledata\": [\n",
+        size * 16,
+        size * 16
+    );
+    
+    srand(1);
+    
+    for (int y = 0; y < size; y++) {
+        offset += sprintf(result + offset, "                        ");
+        
+        for (int x = 0; x < size; x++)
+            offset += sprintf(
+                result + offset, 
+                (x < size - 1 || y < size - 1) ? "%d, " : "%d", 
+                (rand() % 64) - 1
+            );
+        
+        result[offset++] = '\n';
+    }
+    
+    offset += sprintf(
+        result + offset,
+        "                    ]\n"
+        "                }\n"
+        "            ]\n"
+        "        }\n"
+        "    ]\n"
+        "}\n"
+    );
+    
+    *length = offset;
+    
+    return result;
+}
+
+/* 힙 메모리를 사용하는 디코더로 `text`를 한 번 디코딩한다. */
+static int DecodeHeap(const char *text) {
+    JsonNode *node = json_decode(text);
+    
+    if (node == NULL)
+        return 0;
+    
+    json_delete(node);
+    
+    return 1;
+}
+
+/* 아레나를 사용하는 디코더로 `text`를 한 번 디코딩한다. */
+static int DecodeArena(const char *text) {
+    JsonArena *arena = json_arena_new();
+    
+    int result = (json_decode_arena(text, arena) != NULL);
+    
+    json_arena_free(arena);
+    
+    return result;
+}
+
+/* `decode`로 `text`를 `MIN_DURATION`초 이상 반복해서 디코딩하고, 처리량 (MB/s)을 반환한다. */
+static double MeasureThroughput(int (*decode)(const char *), const char *text, size_t length) {
+    double begin, elapsed;
+    
+    long count = 0;
+    
+    begin = GetSeconds();
+    
+    do {
+        if (!decode(text))
+            return -1.0;
+        
+        count++;
+        
+        elapsed = GetSeconds() - begin;
+    } while (elapsed < MIN_DURATION);
+    
+    return ((double) length * count) / (elapsed * 1024.0 * 1024.0);
+}
+
+/* `name`에 해당하는 JSON 데이터의 디코딩 처리량을 출력한다. */
+static void PrintThroughput(const char *name, const char *text, size_t length) {
+    printf(
+        "%-6s %-40s %10.2f KiB  heap %8.1f MB/s  arena %8.1f MB/s\n",
+        SCANNER_NAME,
+        name,
+        length / 1024.0,
+        MeasureThroughput(DecodeHeap, text, length),
+        MeasureThroughput(DecodeArena, text, length)
+    );
+}
+
+int main(int argc, char *argv[]) {
+    char name[64], *text;
+    
+    size_t length;
+    
+    int path_count = (argc > 1) ? argc - 1 : 1;
+    
+    for (int i = 0; i < path_count; i++) {
+        const char *path = (argc > 1) ? argv[i + 1] : DEFAULT_MAP_PATH;
+        
+        if ((text = ReadFileText(path, &length)) == NULL) {
+            fprintf(stderr, "json_bench: unable to read '%s'\n", path);
+            
+            continue;
+        }
+        
+        PrintThroughput(path, text, length);
+        
+        free(text);
+    }
+    
+    text = GenerateMapText(SYNTHETIC_MAP_SIZE, &length);
+    
+    snprintf(name, sizeof(name), "(synthetic %dx%d tiles)", SYNTHETIC_MAP_SIZE, SYNTHETIC_MAP_SIZE);
+    
+    PrintThroughput(name, text, length);
+    
+    free(text);
+    
+    return 0;
+}
@@ -37,7 +37,13 @@
 
 #define MAX_DRAW_DISTANCE 32
 #define MAX_LAYER_COUNT 32
-#define MAX_OBJECT_COUNT 128
+#define MAX_OBJECT_COUNT 1024
+
+/* 화면에 그려지는 타일의 크기가 이 값보다 작아지면, 타일 대신 미리 축소한 청크 이미지를 그린다. (단위: `픽셀`) */
+#define LOD_TILE_SIZE 4
+
+/* 타일의 밝기의 최댓값. 빛은 상하좌우로 한 칸 퍼질 때마다 밝기가 1씩 줄어든다. */
+#define MAX_LIGHT_LEVEL 15
 
 /* 청크 (일정하게 분할된 맵의 일부분)를 나타내는 구조체. */
 typedef struct LwChunk LwChunk;
@@ -45,16 +51,103 @@ typedef struct LwChunk LwChunk;
 /* 개체를 나타내는 구조체. */
 typedef struct LwObject LwObject;
 
+/* 정적 레이어를 미리 합성한 청크를 나타내는 구조체. */
+typedef struct LwBakedChunk LwBakedChunk;
+
+/* 여러 개의 청크를 묶어서 축소한 이미지의 한 단계를 나타내는 구조체. */
+typedef struct LwLodLevel LwLodLevel;
+
+/* 개체의 고유 번호를 관리하는 역할을 하는 구조체. */
+typedef struct LwObjectPool LwObjectPool;
+
+/* 경로 탐색에 사용되는, 청크 사이의 출입구를 나타내는 그래프 구조체. */
+typedef struct LwPathGraph LwPathGraph;
+
+/* 경로 탐색에 필요한 메모리를 미리 할당해두고 다시 사용하는 구조체. */
+typedef struct LwPathContext LwPathContext;
+
+/* 여러 스레드에서 같은 게임 맵을 동시에 읽을 때, 스레드마다 따로 사용하는 구조체. */
+typedef struct LwQueryContext LwQueryContext;
+
+/* 게임 맵에서 본 적이 있는 타일과 지금 보이는 타일을 청크마다 비트 배열로 나타내는 구조체. */
+typedef struct LwFog LwFog;
+
+/* 게임 맵의 타일마다 빛의 밝기를 나타내는 구조체. */
+typedef struct LwLight LwLight;
+
+/* 게임 맵 파일의 변경을 감지하는 구조체. */
+typedef struct LwMapWatch LwMapWatch;
+
+/* 
+    개체를 가리키는 핸들.
+    
+    하위 16비트는 개체의 고유 번호를, 상위 16비트는 고유 번호의 세대 번호를 나타낸다. 
+    개체가 제거되면 세대 번호가 바뀌므로, 제거된 개체의 핸들로는 다른 개체에 접근할 수 없다.
+*/
+typedef uint32_t LwObjectHandle;
+
+#define LW_NULL_HANDLE ((LwObjectHandle) 0)
+
 /* 
     레이어를 나타내는 구조체.
     
-    `objects`: 게임 맵을 그릴 때 필요한 개체의 배열을 나타낸다.
+    `is_static`: 레이어의 내용이 바뀌지 않는 정적 레이어이면 `true`, 아니라면 `false`이다.
+                 연속된 정적 레이어들은 게임 맵을 불러올 때 청크 단위의 이미지 하나로 
+                 미리 합성된다. 스크롤 비율이 서로 다른 정적 레이어는 따로 합성된다.
+    `parallax`:  카메라가 움직일 때 레이어가 따라 움직이는 비율을 가로, 세로 방향으로 각각 나타낸다. 
+                 기본값은 `(1, 1)`이며, 값이 작을수록 멀리 있는 배경처럼 천천히 움직인다. 레이어마다 
+                 이 비율로 환산된 위치를 기준으로 그릴 청크를 따로 고른다.
+    `objects`:   게임 맵을 그릴 때 필요한 개체의 배열을 나타내며, 게임 맵의 모든 레이어가 함께 사용한다.
+    `_baked`:    라이브러리 내부에서 사용되는 변수이다.
+    `_merged`:   라이브러리 내부에서 사용되는 변수이다.
+    `_first_object`: 라이브러리 내부에서 사용되는 변수이다.
+    `_last_object`:  라이브러리 내부에서 사용되는 변수이다.
+    `_lod`:          라이브러리 내부에서 사용되는 변수이다.
+    `_lod_count`:    라이브러리 내부에서 사용되는 변수이다.
 */
 typedef struct LwLayer {
     bool _valid;
+    bool is_static;
+    Vector2 parallax;
     LwObject *objects;
+    LwBakedChunk *_baked;
+    bool _merged;
+    int _first_object;
+    int _last_object;
+    LwLodLevel *_lod;
+    int _lod_count;
 } LwLayer;
 
+/* 
+    청크가 변경되었을 때, 다시 계산해야 하는 데이터의 종류를 나타내는 열거형.
+    
+    `LW_DIRTY_RENDER`: 미리 합성된 정적 레이어의 청크를 다시 합성해야 한다.
+    `LW_DIRTY_SAVE`:   게임 맵 데이터를 저장할 때 청크를 다시 저장해야 한다.
+    `LW_DIRTY_PATH`:   경로 탐색에 사용되는 청크의 출입구를 다시 계산해야 한다. (충돌 판정이 있는 개체만 해당)
+    `LW_DIRTY_LOD`:    청크가 포함된, 미리 축소한 청크 묶음의 이미지를 다시 만들어야 한다.
+*/
+typedef enum LwDirtyFlag {
+    LW_DIRTY_NONE = 0,
+    LW_DIRTY_RENDER = (1 << 0),
+    LW_DIRTY_SAVE = (1 << 1),
+    LW_DIRTY_PATH = (1 << 2),
+    LW_DIRTY_LOD = (1 << 3),
+    LW_DIRTY_ALL = (LW_DIRTY_RENDER | LW_DIRTY_SAVE | LW_DIRTY_PATH | LW_DIRTY_LOD)
+} LwDirtyFlag;
+
+/* 
+    타일 데이터를 압축할 때 사용할 방식을 나타내는 열거형.
+    
+    `LW_COMPRESSION_NONE`: 타일 데이터를 압축하지 않는다.
+    `LW_COMPRESSION_RLE`:  같은 타일이 연속되는 부분을 `(타일, 반복 횟수)` 쌍으로 압축한다.
+    `LW_COMPRESSION_LZ`:   `LW_COMPRESSION_RLE`로 압축한 데이터를 LZ 계열의 방식으로 한 번 더 압축한다.
+*/
+typedef enum LwCompression {
+    LW_COMPRESSION_NONE = 0,
+    LW_COMPRESSION_RLE,
+    LW_COMPRESSION_LZ
+} LwCompression;
+
 /* 
     게임 맵에서 사용할 단위를 나타내는 구조체.
     
@@ -68,6 +161,35 @@ typedef struct LwMapUnit {
     int t;
 } LwMapUnit;
 
+/* 
+    타일 기준 좌표를 나타내는 구조체. 게임 맵 또는 개체 텍스처의 범위를 벗어난 좌표나 
+    음수 좌표도 나타낼 수 있다.
+*/
+typedef struct LwTileCoord {
+    int x;
+    int y;
+} LwTileCoord;
+
+/* 
+    청크 기준 좌표를 나타내는 구조체. 게임 맵 또는 개체 텍스처의 범위를 벗어난 좌표나 
+    음수 좌표도 나타낼 수 있다.
+*/
+typedef struct LwChunkCoord {
+    int x;
+    int y;
+} LwChunkCoord;
+
+/* 
+    타일 또는 청크의 크기가 2의 거듭제곱일 때, 나눗셈 대신 사용할 비트 시프트 값을 나타내는 구조체.
+    크기가 2의 거듭제곱이 아니라면 값은 `0`이다.
+*/
+typedef struct LwMapShift {
+    int tile_width;
+    int tile_height;
+    int chunk_width;
+    int chunk_height;
+} LwMapShift;
+
 /* 
     게임 맵을 나타내는 구조체.
     
@@ -85,7 +207,20 @@ typedef struct LwMapUnit {
                      `k`일 경우, 총 `(2k + 1)^2`개의 청크를 로드하게 된다.)
     `object_table`:  개체의 고유 번호와 개체가 속한 레이어의 고유 번호가 저장된 배열이다.
     `layers`:        게임 맵을 그릴 때 필요한 레이어의 배열을 나타낸다.
+    `compression`:   게임 맵 데이터를 저장할 때, 타일셋 개체의 타일 데이터를 청크마다 압축할 방식을 나타낸다.
+    `lazy_load`:     `true`일 경우, 게임 맵 데이터를 불러올 때 개체의 기본 정보만 불러오고 
+                     개체의 텍스처와 타일 데이터는 개체를 처음 사용할 때 불러온다.
     `load_texture`:  게임 맵의 텍스처 데이터를 불러올 때 사용할 함수의 포인터이다.
+    `_pool`:         라이브러리 내부에서 사용되는 변수이다.
+    `_source`:       라이브러리 내부에서 사용되는 변수이다.
+    `_shift`:        라이브러리 내부에서 사용되는 변수이다.
+    `_width_shift`:  라이브러리 내부에서 사용되는 변수이다.
+    `_solid`:        라이브러리 내부에서 사용되는 변수이다.
+    `_path_graph`:   라이브러리 내부에서 사용되는 변수이다.
+    `_revision`:     라이브러리 내부에서 사용되는 변수이다.
+    `_fog`:          라이브러리 내부에서 사용되는 변수이다.
+    `_light`:        라이브러리 내부에서 사용되는 변수이다.
+    `_watch`:        라이브러리 내부에서 사용되는 변수이다.
 */
 typedef struct LwMap {
     char *name;
@@ -98,20 +233,170 @@ typedef struct LwMap {
     int draw_distance;
     int *object_table;
     LwLayer *layers;
+    LwCompression compression;
+    bool lazy_load;
     Texture2D (*load_texture)(const char *);
+    LwObjectPool *_pool;
+    char *_source;
+    LwMapShift _shift;
+    LwMapUnit _width_shift;
+    uint32_t *_solid;
+    LwPathGraph *_path_graph;
+    unsigned int _revision;
+    LwFog *_fog;
+    LwLight *_light;
+    LwMapWatch *_watch;
 } LwMap;
 
+/* 
+    사각형을 이동시켰을 때, 충돌 판정이 있는 타일과 처음으로 부딪힌 결과를 나타내는 구조체.
+    
+    `hit`:      충돌 판정이 있는 타일과 부딪혔으면 `true`, 아니라면 `false`이다.
+    `time`:     부딪힐 때까지 이동한 거리를 전체 이동 거리에 대한 비율로 나타내며, 범위는 `[0, 1]`이다.
+    `position`: 부딪힌 순간의 사각형의 위치를 나타낸다. 부딪히지 않았다면 이동을 마친 위치이다.
+    `normal`:   부딪힌 타일 면의 법선 벡터를 나타낸다. 처음부터 겹쳐 있었다면 `(0, 0)`이다.
+    `tile`:     부딪힌 타일의 타일 기준 좌표를 나타낸다.
+*/
+typedef struct LwSweepResult {
+    bool hit;
+    float time;
+    Vector2 position;
+    Vector2 normal;
+    LwTileCoord tile;
+} LwSweepResult;
+
+/* 
+    광선을 쏘았을 때, 광선을 가로막는 첫 번째 타일을 나타내는 구조체.
+    
+    `hit`:      광선을 가로막는 타일이 있으면 `true`, 아니라면 `false`이다.
+    `distance`: 광선이 타일에 닿을 때까지의 거리를 나타내며, 단위는 `픽셀`이다.
+    `position`: 광선이 타일에 닿은 위치를 나타낸다.
+    `normal`:   광선이 닿은 타일 면의 법선 벡터를 나타낸다. 광선이 타일 안에서 시작했다면 `(0, 0)`이다.
+    `tile`:     광선을 가로막은 타일의 타일 기준 좌표를 나타낸다.
+    `tile_id`:  광선을 가로막은 타일의 고유 번호를 나타내며, 없다면 `-1`이다.
+*/
+typedef struct LwRaycastResult {
+    bool hit;
+    float distance;
+    Vector2 position;
+    Vector2 normal;
+    LwTileCoord tile;
+    int tile_id;
+} LwRaycastResult;
+
+/* 
+    한 번에 여러 개의 광선을 쏠 때, 광선 하나를 나타내는 구조체.
+    
+    `origin`:       광선의 시작 위치를 나타낸다.
+    `direction`:    광선의 방향을 나타내며, 길이는 상관없다.
+    `max_distance`: 광선의 최대 길이를 나타내며, 단위는 `픽셀`이다.
+*/
+typedef struct LwRaycastQuery {
+    Vector2 origin;
+    Vector2 direction;
+    float max_distance;
+} LwRaycastQuery;
+
+/* 
+    게임 맵의 타일마다 대표 색상 하나를 그린 미니맵을 나타내는 구조체.
+    
+    `image`:       미니맵 이미지를 나타내며, 픽셀 하나가 타일 하나에 해당한다. 
+                   픽셀 형식은 `PIXELFORMAT_UNCOMPRESSED_R8G8B8A8`이다.
+    `_signatures`: 라이브러리 내부에서 사용되는 변수이다.
+*/
+typedef struct LwMinimap {
+    Image image;
+    uint64_t *_signatures;
+} LwMinimap;
+
+/* 월드를 구성하는 격자의 한 칸을 나타내는 구조체. */
+typedef struct LwWorldCell LwWorldCell;
+
+/* 
+    여러 개의 게임 맵을 격자 형태로 이어붙인 월드를 나타내는 구조체.
+    
+    `name`:          월드의 이름을 나타낸다.
+    `width`:         격자의 가로 칸 수를 나타낸다.
+    `height`:        격자의 세로 칸 수를 나타낸다.
+    `map_width`:     격자 한 칸에 해당하는 게임 맵의 가로 길이를 나타내며, 단위는 `픽셀`이다.
+    `map_height`:    격자 한 칸에 해당하는 게임 맵의 세로 길이를 나타내며, 단위는 `픽셀`이다.
+    `load_distance`: 플레이어가 있는 칸을 기준으로 주변 몇 칸까지의 게임 맵을 메모리에 올려둘 것인지를 
+                     나타낸다. 이보다 한 칸 더 멀리 떨어진 게임 맵은 메모리에서 해제된다.
+    `lazy_load`:     월드에 포함된 게임 맵의 `lazy_load` 값을 나타낸다.
+    `load_texture`:  게임 맵의 텍스처 데이터를 불러올 때 사용할 함수의 포인터이다.
+    `_cells`:        라이브러리 내부에서 사용되는 변수이다.
+*/
+typedef struct LwWorld {
+    char *name;
+    int width;
+    int height;
+    int map_width;
+    int map_height;
+    int load_distance;
+    bool lazy_load;
+    Texture2D (*load_texture)(const char *);
+    LwWorldCell *_cells;
+} LwWorld;
+
 /* ::: 게임 맵 관련 함수 ::: */
 
-/* 파일에서 게임 맵 데이터를 불러온다. */
+/* 파일에서 게임 맵 데이터를 불러온다. 저널 파일이 있다면, 저널 파일의 변경 사항도 함께 적용한다. */
 bool LoadMap(LwMap *map, const char *file_path);
 
 /* 메모리에서 게임 맵 데이터를 불러온다. */
 bool LoadMapFromMemory(LwMap *map, char *map_data);
 
-/* 위치 `position`을 기준으로 게임 맵을 화면에 그린다. */
+/* 
+    파일에서 게임 맵 데이터를 다시 읽어, 지금 게임 맵과 달라진 개체와 청크만 반영한다. 
+    바뀌지 않은 개체의 텍스처와 청크는 그대로 남는다.
+*/
+bool ReloadMap(LwMap *map, const char *file_path);
+
+/* 
+    파일 `file_path`의 변경을 감지하기 시작한다. Linux에서는 `inotify`를 사용하며, 
+    사용할 수 없다면 파일의 수정 시각을 비교한다.
+*/
+bool WatchMapFile(LwMap *map, const char *file_path);
+
+/* 감시하는 게임 맵 파일이 바뀌었다면, `ReloadMap()`으로 바뀐 부분만 반영하고 `true`를 반환한다. */
+bool UpdateMapWatch(LwMap *map);
+
+/* 게임 맵 파일의 변경을 더 이상 감지하지 않는다. */
+void UnwatchMapFile(LwMap *map);
+
+/* 
+    위치 `position`을 기준으로 게임 맵을 화면에 그린다. 스크롤 비율이 `(1, 1)`이 아닌 레이어는 
+    비율에 맞게 옮겨진 위치에 그려진다.
+*/
 void DrawMap(LwMap *map, Vector2 position);
 
+/* 
+    위치 `position`을 기준으로, 확대 배율이 `zoom`인 화면에 게임 맵을 그린다. 화면에 그려지는 타일의 
+    크기가 `LOD_TILE_SIZE`보다 작다면, 화면을 채우는 데 충분한 가장 작은 축소 이미지를 대신 그린다.
+    축소 이미지는 `UpdateMapLod()`로 미리 만들어두어야 한다.
+*/
+void DrawMapEx(LwMap *map, Vector2 position, float zoom);
+
+/* 
+    위치 `position`을 기준으로, 확대 배율이 `zoom`인 화면에 보이는 청크 묶음의 축소 이미지 중에서 
+    아직 만들지 않았거나 바뀐 이미지를 만든다. 렌더 텍스처에 그림을 그려야 하므로, `BeginMode2D()`와 
+    `EndMode2D()` 사이에서는 호출하면 안 된다.
+*/
+void UpdateMapLod(LwMap *map, Vector2 position, float zoom);
+
+/* 
+    타일셋 이미지에서 구한 타일마다의 대표 색상으로 게임 맵의 미니맵 이미지를 만든다. 스크롤 비율이 
+    `(1, 1)`인 레이어의 타일셋 개체만 그리며, 위쪽 레이어의 불투명한 타일이 아래쪽 타일을 가린다. 
+    렌더 텍스처를 사용하지 않으므로, 창을 만들지 않고도 사용할 수 있다.
+*/
+bool LoadMinimap(LwMap *map, LwMinimap *minimap);
+
+/* 미니맵을 마지막으로 만든 이후 바뀐 청크만 다시 그리고, 다시 그린 청크의 개수를 반환한다. */
+int UpdateMinimap(LwMap *map, LwMinimap *minimap);
+
+/* 미니맵의 메모리를 해제한다. */
+void UnloadMinimap(LwMinimap *minimap);
+
 /* 위치 `position`이 게임 맵 안쪽에 해당하는 위치인지 확인한다. */
 bool IsInsideMap(LwMap *map, Vector2 position);
 
@@ -121,6 +406,15 @@ bool SaveMap(LwMap *map, const char *file_path);
 /* 게임 맵 데이터를 메모리에 저장한다. */
 bool SaveMapToMemory(LwMap *map, char **map_data);
 
+/* 
+    마지막으로 저장한 이후 변경된 청크와 개체만 게임 맵 파일의 저널 파일 
+    (`file_path` + `.journal`)에 덧붙여 저장한다.
+*/
+bool SaveMapJournal(LwMap *map, const char *file_path);
+
+/* 게임 맵의 저널 파일에 기록된 변경 사항을 게임 맵 파일에 합친 다음, 저널 파일을 삭제한다. */
+bool CompactMapJournal(LwMap *map, const char *file_path);
+
 /* 게임 맵 데이터의 메모리를 해제한다. */
 void UnloadMap(LwMap *map);
 
@@ -129,13 +423,38 @@ void UnloadMap(LwMap *map);
 /* 고유 번호가 `index`인 개체의 메모리 주소를 반환한다. */
 LwObject *GetObject(LwMap *map, int index);
 
+/* 핸들 `handle`이 가리키는 개체의 메모리 주소를 반환한다. 이미 제거된 개체라면 `NULL`을 반환한다. */
+LwObject *GetObjectByHandle(LwMap *map, LwObjectHandle handle);
+
+/* 개체 `object`를 가리키는 핸들을 반환한다. */
+LwObjectHandle GetObjectHandle(LwMap *map, LwObject *object);
+
+/* 
+    고유 번호가 `layer_id`인 레이어에 이미지 파일의 경로가 `image_path`인 개체를 위치 `position`에 
+    새로 만들고, 그 개체를 가리키는 핸들을 반환한다. 사용할 수 있는 고유 번호가 없다면 
+    `LW_NULL_HANDLE`을 반환한다.
+*/
+LwObjectHandle CreateObject(LwMap *map, int layer_id, const char *image_path, Vector2 position);
+
+/* 핸들 `handle`이 가리키는 개체를 제거하고, 그 개체의 고유 번호를 다시 사용할 수 있도록 한다. */
+bool DestroyObject(LwMap *map, LwObjectHandle handle);
+
+/* 
+    개체 `object`의 텍스처와 타일 데이터를 불러온다. `map.lazy_load`가 `true`일 때, 개체를 그리기 
+    전에 미리 불러오고 싶다면 이 함수를 호출하면 된다. 이미 불러온 개체라면 아무 것도 하지 않는다.
+*/
+bool LoadObject(LwMap *map, LwObject *object);
+
+/* 개체 `object`의 텍스처와 타일 데이터를 이미 불러왔는지 확인한다. */
+bool IsObjectLoaded(LwObject *object);
+
 /* 개체의 현재 위치를 반환한다. */
 Vector2 GetObjectPosition(LwObject *object);
 
-/* 개체 텍스처의 가로 길이를 반환한다. */
+/* 개체 이미지의 가로 길이를 반환한다. 텍스처를 불러오지 않았어도 크기를 알 수 있다. */
 double GetObjectWidth(LwObject *object);
 
-/* 개체 텍스처의 세로 길이를 반환한다. */
+/* 개체 이미지의 세로 길이를 반환한다. 텍스처를 불러오지 않았어도 크기를 알 수 있다. */
 double GetObjectHeight(LwObject *object);
 
 /* 
@@ -164,12 +483,26 @@ void LoadChunks(LwMap *map, LwObject *object, Vector2 position);
 /* 거리가 `map.draw_distance` 이하인 청크의 최대 개수를 반환한다. */
 int GetAdjacentChunkCount(LwMap *map);
 
+/* 
+    고유 번호가 `index`인 청크에서 거리가 `map.draw_distance` 이하인 청크의 고유 번호를 최대 
+    `max_count`개까지 `indexes`에 저장하고, 그러한 청크의 개수를 반환한다. 개체의 데이터는 
+    변경하지 않으므로 여러 스레드에서 동시에 호출할 수 있다.
+*/
+int GetAdjacentChunkIndexes(LwMap *map, LwObject *object, int index, int *indexes, int max_count);
+
 /* 
     고유 번호가 `index`인 청크에서 거리가 `map.draw_distance` 이하인 모든 청크의 고유 번호를 
     구한 다음, `object.chunk_indexes`에 저장한다.
 */
 void UpdateAdjacentChunkIndexes(LwMap *map, LwObject *object, int index);
 
+/* 
+    위치 `position`에서 `map.draw_distance + 1`보다 멀리 떨어진 청크의 타일 데이터를 모두 압축하고,
+    압축된 청크의 개수를 반환한다. 압축된 청크는 다시 그려지거나 수정될 때 자동으로 압축이 풀린다.
+    거리는 레이어마다 스크롤 비율로 환산된 위치를 기준으로 잰다.
+*/
+int PackColdChunks(LwMap *map, Vector2 position);
+
 /* 게임 맵에서 고유 번호가 `index`인 청크의 청크 기준 X좌표를 반환한다. */
 int GetMapChunkX(LwMap *map, int index);
 
@@ -212,6 +545,27 @@ int PositionToTileIndexMap(LwMap *map, Vector2 position);
 /* 개체 텍스처에서 위치 `position`이 속한 타일의 인덱스를 구한다. */
 int PositionToTileIndexObject(LwMap *map, LwObject *object, Vector2 position);
 
+/* 
+    게임 맵에서 위치 `position`이 속한 타일의 타일 기준 좌표를 구한다. 
+    게임 맵을 벗어난 위치나 음수 위치도 내림하여 계산한다.
+*/
+LwTileCoord PositionToTileCoordMap(LwMap *map, Vector2 position);
+
+/* 
+    개체 텍스처에서 위치 `position`이 속한 타일의 타일 기준 좌표를 구한다.
+    개체 텍스처를 벗어난 위치나 음수 위치도 내림하여 계산한다.
+*/
+LwTileCoord PositionToTileCoordObject(LwMap *map, LwObject *object, Vector2 position);
+
+/* 타일 기준 좌표가 `coord`인 타일이 속한 청크의 청크 기준 좌표를 구한다. */
+LwChunkCoord TileCoordToChunkCoord(LwMap *map, LwTileCoord coord);
+
+/* 게임 맵에서 타일 기준 좌표가 `coord`인 타일의 시작 위치를 구한다. */
+Vector2 TileCoordToPositionMap(LwMap *map, LwTileCoord coord);
+
+/* 개체 텍스처에서 타일 기준 좌표가 `coord`인 타일의 시작 위치를 구한다. */
+Vector2 TileCoordToPositionObject(LwMap *map, LwObject *object, LwTileCoord coord);
+
 /* 게임 맵에서 고유 번호가 `chunk_index`인 청크의 `relative_tile_index + 1`번째 타일의 시작 위치를 구한다. */
 Vector2 RelativeTileIndexToPositionMap(
     LwMap *map, 
@@ -236,4 +590,251 @@ Vector2 TileIndexToPositionMap(LwMap *map, int index);
 /* 고유 번호가 `index`인 타일의 시작 위치를 구한다. */
 Vector2 TileIndexToPositionObject(LwMap *map, LwObject *object, int index);
 
+/* ::: 타일 관련 함수 ::: */
+
+/* 개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 고유 번호를 반환한다. */
+int GetTile(LwMap *map, LwObject *object, int tile_x, int tile_y);
+
+/* 
+    개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 지형 고유 번호를 반환한다. 
+    자동 타일이 아니라면 `GetTile()`과 같은 값을 반환한다.
+*/
+int GetTerrain(LwMap *map, LwObject *object, int tile_x, int tile_y);
+
+/* 
+    게임 맵 `map`의 타일을 여러 스레드에서 동시에 읽을 때 사용할 컨텍스트를 만든다. 
+    컨텍스트는 스레드마다 하나씩 만들어야 하며, 게임 맵의 청크 크기가 바뀌면 다시 만들어야 한다.
+*/
+LwQueryContext *LoadQueryContext(LwMap *map);
+
+/* 읽기 컨텍스트의 메모리를 해제한다. */
+void UnloadQueryContext(LwQueryContext *context);
+
+/* 
+    컨텍스트 `context`를 사용하여 개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 
+    고유 번호를 반환한다. `GetTile()`과 달리 개체나 청크를 불러오거나 압축을 풀어두지 않으므로, 
+    게임 맵을 변경하는 스레드가 없다면 여러 스레드에서 동시에 호출할 수 있다. 
+    아직 불러오지 않은 개체라면 `-1`을 반환한다.
+*/
+int QueryTile(LwQueryContext *context, LwObject *object, int tile_x, int tile_y);
+
+/* 
+    컨텍스트 `context`를 사용하여 개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 
+    지형 고유 번호를 반환한다. `QueryTile()`과 마찬가지로 여러 스레드에서 동시에 호출할 수 있다.
+*/
+int QueryTerrain(LwQueryContext *context, LwObject *object, int tile_x, int tile_y);
+
+/* 
+    개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 고유 번호를 `tile_id`로 
+    변경하고, 그 타일이 속한 청크를 변경된 청크로 표시한다. `tile_id`가 자동 타일의 지형이라면, 
+    그 타일과 주변 8칸의 타일만 지형에 맞게 다시 고른다.
+*/
+bool SetTile(LwMap *map, LwObject *object, int tile_x, int tile_y, int tile_id);
+
+/* 
+    개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일부터 가로 `width`개, 
+    세로 `height`개의 타일을 모두 `tile_id`로 변경하고, 변경된 타일의 개수를 반환한다.
+*/
+int FillTileRect(
+    LwMap *map, LwObject *object, 
+    int tile_x, int tile_y, 
+    int width, int height, 
+    int tile_id
+);
+
+/* 
+    개체 `object`에서 `flag`에 해당하는 변경 사항이 있는 청크의 고유 번호를 최대 `max_count`개까지 
+    `indexes`에 저장하고, 그러한 청크의 개수를 반환한다.
+*/
+int GetDirtyChunkIndexes(LwObject *object, LwDirtyFlag flag, int *indexes, int max_count);
+
+/* 개체 `object`의 모든 청크에서 `flag`에 해당하는 변경 사항 표시를 지운다. */
+void ClearDirtyChunks(LwObject *object, LwDirtyFlag flag);
+
+/* 
+    정적 레이어에 속한 개체의 타일이 변경되었을 경우, 변경된 청크만 다시 합성한다. 변경된 청크가 
+    포함된 축소 이미지는 `UpdateMapLod()`를 호출할 때 다시 만들어진다.
+    렌더 텍스처에 그림을 그려야 하므로, `BeginMode2D()`와 `EndMode2D()` 사이에서는 호출하면 안 된다.
+*/
+void UpdateStaticLayers(LwMap *map);
+
+/* 
+    개체 `object`에서 고유 번호가 `tile_id`인 타일에 애니메이션이 있다면 현재 프레임의 타일 고유 번호를, 
+    애니메이션이 없다면 `tile_id`를 그대로 반환한다.
+*/
+int GetAnimatedTileId(LwObject *object, int tile_id);
+
+/* 
+    게임 맵의 모든 타일 애니메이션을 `delta_time`초만큼 진행시킨다. 미리 합성된 정적 레이어에서는 
+    애니메이션 프레임이 바뀐 타일만 다시 그리므로, 애니메이션이 있는 타일의 개수에만 비례하는 
+    시간이 걸린다. 렌더 텍스처에 그림을 그려야 하므로, `BeginMode2D()`와 `EndMode2D()` 사이에서는 
+    호출하면 안 된다.
+*/
+void UpdateTileAnimations(LwMap *map, float delta_time);
+
+/* ::: 충돌 관련 함수 ::: */
+
+/* 
+    게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일에 충돌 판정이 있는지 확인한다. 
+    타일셋 개체의 `solid_tiles`에 포함된 고유 번호의 타일만 충돌 판정이 있다.
+*/
+bool IsTileSolid(LwMap *map, int tile_x, int tile_y);
+
+/* 게임 맵에서 위치 `position`이 속한 타일에 충돌 판정이 있는지 확인한다. */
+bool IsTileSolidAt(LwMap *map, Vector2 position);
+
+/* 게임 맵에서 사각형 `rect`와 겹치는 타일 중에 충돌 판정이 있는 타일이 있는지 확인한다. */
+bool QuerySolidInRect(LwMap *map, Rectangle rect);
+
+/* 
+    게임 맵에서 사각형 `rect`를 `delta`만큼 이동시켰을 때, 충돌 판정이 있는 타일과 처음으로 
+    부딪히는 위치를 구한다.
+*/
+LwSweepResult SweepSolidRect(LwMap *map, Rectangle rect, Vector2 delta);
+
+/* 
+    타일셋 개체 `object`에서 위치 `origin`으로부터 방향 `direction`으로 최대 `max_distance`만큼 
+    광선을 쏘아, 광선을 가로막는 첫 번째 타일을 구한다. 개체에 `solid_tiles`가 있다면 충돌 판정이 
+    있는 타일만, 없다면 비어 있지 않은 모든 타일이 광선을 가로막는다.
+*/
+LwRaycastResult RaycastTiles(
+    LwMap *map, LwObject *object, 
+    Vector2 origin, Vector2 direction, float max_distance
+);
+
+/* 타일셋 개체 `object`에서 위치 `from`과 `to` 사이를 가로막는 타일이 없는지 확인한다. */
+bool HasLineOfSight(LwMap *map, LwObject *object, Vector2 from, Vector2 to);
+
+/* 
+    타일셋 개체 `object`에서 `count`개의 광선 `queries`를 한 번에 쏘아 결과를 `results`에 저장하고, 
+    타일에 부딪힌 광선의 개수를 반환한다. 광선이 충분히 많다면 여러 스레드로 나누어 처리한다.
+*/
+int RaycastTilesBatch(
+    LwMap *map, LwObject *object, 
+    const LwRaycastQuery *queries, LwRaycastResult *results, 
+    int count
+);
+
+/* ::: 경로 탐색 관련 함수 ::: */
+
+/* 
+    게임 맵 `map`에서 경로를 탐색할 때 사용할 메모리를 미리 할당한다. 같은 컨텍스트로 경로를 여러 번 
+    탐색해도 메모리를 다시 할당하지 않는다. 게임 맵의 크기가 바뀌면 다시 만들어야 한다.
+*/
+LwPathContext *LoadPathContext(LwMap *map);
+
+/* 경로 탐색 컨텍스트의 메모리를 해제한다. */
+void UnloadPathContext(LwPathContext *context);
+
+/* 
+    타일 `start`에서 타일 `goal`까지 충돌 판정이 없는 타일만 상하좌우로 지나가는 경로를 찾아, 
+    `start`와 `goal`을 포함한 경로를 최대 `max_length`개까지 `path`에 저장한다. 
+    경로 전체의 길이를 반환하며, 경로가 없다면 `-1`을 반환한다.
+*/
+int FindPath(
+    LwPathContext *context, 
+    LwTileCoord start, LwTileCoord goal, 
+    LwTileCoord *path, int max_length
+);
+
+/* 
+    모든 타일에서 타일 `goal`까지의 거리를 계산하여, 여러 개체가 같은 목적지로 이동할 때 사용할 
+    흐름 필드를 만든다. 흐름 필드는 다시 만들기 전까지 컨텍스트에 저장된다.
+*/
+bool BuildFlowField(LwPathContext *context, LwTileCoord goal);
+
+/* 흐름 필드에서 타일 `tile`에서 목적지로 가기 위해 다음으로 이동할 타일을 반환한다. */
+LwTileCoord GetFlowFieldNext(LwPathContext *context, LwTileCoord tile);
+
+/* 흐름 필드에서 타일 `tile`부터 목적지까지의 거리를 반환한다. 갈 수 없는 타일이라면 `-1`을 반환한다. */
+int GetFlowFieldCost(LwPathContext *context, LwTileCoord tile);
+
+/* ::: 전장의 안개 관련 함수 ::: */
+
+/* 
+    타일 기준 좌표가 `center`인 타일에서 반지름이 `radius`인 원 안의 타일을 지금 보이는 타일과 
+    본 적이 있는 타일로 표시한다. 충돌 판정이 있는 타일에 가려지는지는 확인하지 않는다.
+*/
+void RevealFogRadius(LwMap *map, LwTileCoord center, int radius);
+
+/* 
+    타일 기준 좌표가 `center`인 타일에서 반지름이 `radius`인 원 안의 타일 중, 충돌 판정이 있는 
+    타일에 가려지지 않은 타일만 지금 보이는 타일과 본 적이 있는 타일로 표시한다.
+*/
+void RevealFogShadowcast(LwMap *map, LwTileCoord center, int radius);
+
+/* 지금 보이는 타일의 표시를 모두 지운다. 본 적이 있는 타일의 표시는 그대로 남는다. */
+void ClearFogVisible(LwMap *map);
+
+/* 타일 기준 좌표가 `(x, y)`인 타일을 본 적이 있는지 확인한다. */
+bool IsTileExplored(LwMap *map, int x, int y);
+
+/* 타일 기준 좌표가 `(x, y)`인 타일이 지금 보이는지 확인한다. */
+bool IsTileVisible(LwMap *map, int x, int y);
+
+/* 본 적이 있는 타일의 표시를 파일에 저장한다. */
+bool SaveFog(LwMap *map, const char *file_path);
+
+/* 본 적이 있는 타일의 표시를 메모리에 저장한다. */
+bool SaveFogToMemory(LwMap *map, char **fog_data);
+
+/* 파일에서 본 적이 있는 타일의 표시를 불러온다. */
+bool LoadFog(LwMap *map, const char *file_path);
+
+/* 메모리에서 본 적이 있는 타일의 표시를 불러온다. */
+bool LoadFogFromMemory(LwMap *map, const char *fog_data);
+
+/* 전장의 안개에 할당된 메모리를 해제한다. 전장의 안개가 없으면 모든 타일이 보인다. */
+void UnloadFog(LwMap *map);
+
+/* ::: 조명 관련 함수 ::: */
+
+/* 
+    타일 기준 좌표가 `position`인 타일에 밝기가 `level`인 빛을 추가한다. 빛은 타일셋 개체의 
+    `opaque_tiles`에 포함된 타일에 가로막히며, 빛이 닿는 타일의 밝기만 다시 계산한다.
+*/
+bool AddLight(LwMap *map, LwTileCoord position, int level);
+
+/* 타일 기준 좌표가 `position`인 타일에 추가된 빛을 하나 제거한다. */
+bool RemoveLight(LwMap *map, LwTileCoord position);
+
+/* 빛이 닿지 않는 타일에도 적용할 최소 밝기를 `level`로 설정한다. */
+void SetAmbientLight(LwMap *map, int level);
+
+/* 
+    타일 기준 좌표가 `(x, y)`인 타일의 밝기를 반환한다. 최소 밝기는 반영하지 않는다. 
+    조명이 없다면 `MAX_LIGHT_LEVEL`을 반환한다.
+*/
+int GetTileLight(LwMap *map, int x, int y);
+
+/* 조명에 할당된 메모리를 해제한다. 조명이 없으면 모든 타일을 원래의 색상으로 그린다. */
+void UnloadLights(LwMap *map);
+
+/* ::: 월드 관련 함수 ::: */
+
+/* 
+    파일에서 월드 데이터를 불러온다. 월드에 포함된 게임 맵은 `UpdateWorld()`를 호출할 때 
+    플레이어의 위치에 따라 불러온다.
+*/
+bool LoadWorld(LwWorld *world, const char *file_path);
+
+/* 월드 데이터와 월드에 포함된 모든 게임 맵의 메모리를 해제한다. */
+void UnloadWorld(LwWorld *world);
+
+/* 
+    월드 기준 위치 `position`을 기준으로, 가까운 게임 맵은 백그라운드에서 불러오고 먼 게임 맵은 
+    메모리에서 해제한다. 플레이어가 있는 칸의 게임 맵은 바로 사용할 수 있도록 기다렸다가 불러온다.
+    렌더 텍스처에 그림을 그릴 수 있으므로, `BeginMode2D()`와 `EndMode2D()` 사이에서는 호출하면 안 된다.
+*/
+void UpdateWorld(LwWorld *world, Vector2 position);
+
+/* 월드 기준 위치 `position`을 기준으로, 주변의 게임 맵을 경계 없이 이어서 화면에 그린다. */
+void DrawWorld(LwWorld *world, Vector2 position);
+
+/* 격자 좌표가 `(x, y)`인 칸의 게임 맵을 반환한다. 아직 불러오지 않은 게임 맵이라면 `NULL`을 반환한다. */
+LwMap *GetWorldMap(LwWorld *world, int x, int y);
+
+/* 격자 좌표가 `(x, y)`인 칸의 게임 맵이 시작되는 월드 기준 위치를 반환한다. */
+Vector2 GetWorldMapOrigin(LwWorld *world, int x, int y);
+
 #endif
\ No newline at end of file
@@ -29,6 +29,27 @@
 #include <stdlib.h>
 #include <string.h>
 
+/*
+ * Define JSON_NO_SSE2 to build the scalar scanners even when the compiler
+ * targets SSE2, e.g. to compare both paths.
+ */
+#if !defined(JSON_NO_SSE2) \
+	&& (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define JSON_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+/*
+ * The SIMD scanners only issue 16-byte aligned loads, which never cross
+ * a page boundary, but they may read past the terminating NUL within the
+ * same 16 bytes.  Keep AddressSanitizer from reporting those reads.
+ */
+#if defined(JSON_USE_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define JSON_NO_SANITIZE __attribute__((no_sanitize_address))
+#else
+#define JSON_NO_SANITIZE
+#endif
+
 #define out_of_memory() do {                    \
 		fprintf(stderr, "Out of memory.\n");    \
 		exit(EXIT_FAILURE);                     \
@@ -114,6 +135,110 @@ static void sb_free(SB *sb)
 	free(sb->start);
 }
 
+/*
+ * Arena allocator
+ *
+ * Nodes and strings produced by json_decode_arena are bump-allocated
+ * from a chain of blocks and released all at once by json_arena_free.
+ */
+
+#define ARENA_MIN_BLOCK (64 * 1024)
+#define ARENA_MAX_BLOCK (4 * 1024 * 1024)
+
+typedef struct ArenaBlock ArenaBlock;
+
+struct ArenaBlock
+{
+	ArenaBlock *next;
+	size_t size;
+	size_t used;
+	/* Followed by size bytes of storage, aligned for any node. */
+};
+
+struct JsonArena
+{
+	ArenaBlock *head;
+	size_t next_size;
+	
+	/* Members with this key are kept as JSON_RAW (see json_decode_raw). */
+	const char *raw_key;
+};
+
+#define ARENA_HEADER_SIZE \
+	((sizeof(ArenaBlock) + sizeof(double) - 1) & ~(sizeof(double) - 1))
+
+#define arena_data(block) ((char*) (block) + ARENA_HEADER_SIZE)
+
+static void *arena_alloc(JsonArena *arena, size_t size, size_t align)
+{
+	ArenaBlock *block = arena->head;
+	size_t offset = 0;
+	
+	if (block != NULL)
+		offset = (block->used + align - 1) & ~(align - 1);
+	
+	if (block == NULL || offset + size > block->size) {
+		size_t alloc = arena->next_size;
+		
+		while (alloc < size)
+			alloc *= 2;
+		
+		block = (ArenaBlock*) malloc(ARENA_HEADER_SIZE + alloc);
+		if (block == NULL)
+			out_of_memory();
+		block->next = arena->head;
+		block->size = alloc;
+		block->used = 0;
+		arena->head = block;
+		
+		if (arena->next_size < ARENA_MAX_BLOCK)
+			arena->next_size *= 2;
+		
+		offset = 0;
+	}
+	
+	block->used = offset + size;
+	return arena_data(block) + offset;
+}
+
+/*
+ * Give back the unused tail of the most recent allocation,
+ * which must start at @ptr and now only needs @size bytes.
+ */
+static void arena_shrink(JsonArena *arena, char *ptr, size_t size)
+{
+	ArenaBlock *block = arena->head;
+	
+	assert(ptr >= arena_data(block) && ptr + size <= arena_data(block) + block->used);
+	block->used = (ptr - arena_data(block)) + size;
+}
+
+JsonArena *json_arena_new(void)
+{
+	JsonArena *arena = (JsonArena*) malloc(sizeof(JsonArena));
+	if (arena == NULL)
+		out_of_memory();
+	arena->head = NULL;
+	arena->next_size = ARENA_MIN_BLOCK;
+	arena->raw_key = NULL;
+	return arena;
+}
+
+void json_arena_free(JsonArena *arena)
+{
+	ArenaBlock *block, *next;
+	
+	if (arena == NULL)
+		return;
+	
+	for (block = arena->head; block != NULL; block = next) {
+		next = block->next;
+		free(block);
+	}
+	
+	free(arena);
+}
+
 /*
  * Unicode helper functions
  *
@@ -328,11 +453,17 @@ static void to_surrogate_pair(uchar_t unicode, uint16_t *uc, uint16_t *lc)
 #define is_space(c) ((c) == '\t' || (c) == '\n' || (c) == '\r' || (c) == ' ')
 #define is_digit(c) ((c) >= '0' && (c) <= '9')
 
-static bool parse_value     (const char **sp, JsonNode        **out);
-static bool parse_string    (const char **sp, char            **out);
+/* ASCII string bytes that can be copied verbatim (no escape, quote, or control). */
+#define is_plain(c) ((unsigned char)(c) >= 0x20 && (unsigned char)(c) < 0x80 \
+                     && (c) != '"' && (c) != '\\')
+
+static size_t scan_plain    (const char *s);
+
+static bool parse_value     (const char **sp, JsonNode        **out, JsonArena *arena);
+static bool parse_string    (const char **sp, char            **out, JsonArena *arena);
 static bool parse_number    (const char **sp, double           *out);
-static bool parse_array     (const char **sp, JsonNode        **out);
-static bool parse_object    (const char **sp, JsonNode        **out);
+static bool parse_array     (const char **sp, JsonNode        **out, JsonArena *arena);
+static bool parse_object    (const char **sp, JsonNode        **out, JsonArena *arena);
 static bool parse_hex16     (const char **sp, uint16_t         *out);
 
 static bool expect_literal  (const char **sp, const char *str);
@@ -341,6 +472,7 @@ static void skip_space      (const char **sp);
 static void emit_value              (SB *out, const JsonNode *node);
 static void emit_value_indented     (SB *out, const JsonNode *node, const char *space, int indent_level);
 static void emit_string             (SB *out, const char *str);
+static void emit_raw                (SB *out, const char *raw);
 static void emit_number             (SB *out, double num);
 static void emit_array              (SB *out, const JsonNode *array);
 static void emit_array_indented     (SB *out, const JsonNode *array, const char *space, int indent_level);
@@ -350,6 +482,7 @@ static void emit_object_indented    (SB *out, const JsonNode *object, const char
 static int write_hex16(char *out, uint16_t val);
 
 static JsonNode *mknode(JsonTag tag);
+static JsonNode *mknode_in(JsonArena *arena, JsonTag tag);
 static void append_node(JsonNode *parent, JsonNode *child);
 static void prepend_node(JsonNode *parent, JsonNode *child);
 static void append_member(JsonNode *object, char *key, JsonNode *value);
@@ -364,7 +497,7 @@ JsonNode *json_decode(const char *json)
 	JsonNode *ret;
 	
 	skip_space(&s);
-	if (!parse_value(&s, &ret))
+	if (!parse_value(&s, &ret, NULL))
 		return NULL;
 	
 	skip_space(&s);
@@ -376,6 +509,51 @@ JsonNode *json_decode(const char *json)
 	return ret;
 }
 
+JsonNode *json_decode_arena(const char *json, JsonArena *arena)
+{
+	const char *s = json;
+	JsonNode *ret;
+	
+	assert(arena != NULL);
+	
+	/* On failure, partial trees stay in the arena until it is freed. */
+	skip_space(&s);
+	if (!parse_value(&s, &ret, arena))
+		return NULL;
+	
+	skip_space(&s);
+	if (*s != 0)
+		return NULL;
+	
+	return ret;
+}
+
+JsonNode *json_decode_raw(const char *json, JsonArena *arena, const char *raw_key)
+{
+	JsonNode *ret;
+	
+	assert(arena != NULL && raw_key != NULL);
+	
+	arena->raw_key = raw_key;
+	ret = json_decode_arena(json, arena);
+	arena->raw_key = NULL;
+	
+	return ret;
+}
+
+JsonNode *json_decode_value(const char **json, JsonArena *arena)
+{
+	const char *s = *json;
+	JsonNode *ret;
+	
+	skip_space(&s);
+	if (!parse_value(&s, &ret, arena))
+		return NULL;
+	
+	*json = s;
+	return ret;
+}
+
 char *json_encode(const JsonNode *node)
 {
 	return json_stringify(node, NULL);
@@ -435,7 +613,7 @@ bool json_validate(const char *json)
 	const char *s = json;
 	
 	skip_space(&s);
-	if (!parse_value(&s, NULL))
+	if (!parse_value(&s, NULL, NULL))
 		return false;
 	
 	skip_space(&s);
@@ -492,6 +670,20 @@ static JsonNode *mknode(JsonTag tag)
 	return ret;
 }
 
+/* Allocate a node from @arena, or from the heap if @arena is NULL. */
+static JsonNode *mknode_in(JsonArena *arena, JsonTag tag)
+{
+	JsonNode *ret;
+	
+	if (arena == NULL)
+		return mknode(tag);
+	
+	ret = (JsonNode*) arena_alloc(arena, sizeof(JsonNode), sizeof(double));
+	memset(ret, 0, sizeof(JsonNode));
+	ret->tag = tag;
+	return ret;
+}
+
 JsonNode *json_mknull(void)
 {
 	return mknode(JSON_NULL);
@@ -523,6 +715,13 @@ JsonNode *json_mknumber(double n)
 	return node;
 }
 
+JsonNode *json_mkraw(const char *raw)
+{
+	JsonNode *ret = mknode(JSON_RAW);
+	ret->raw_ = raw;
+	return ret;
+}
+
 JsonNode *json_mkarray(void)
 {
 	return mknode(JSON_ARRAY);
@@ -533,29 +732,40 @@ JsonNode *json_mkobject(void)
 	return mknode(JSON_OBJECT);
 }
 
+/*
+ * The first child's prev pointer refers to the last child,
+ * so that appending stays O(1) without a separate tail pointer.
+ */
 static void append_node(JsonNode *parent, JsonNode *child)
 {
+	JsonNode *head = parent->children.head;
+	
 	child->parent = parent;
-	child->prev = parent->children.tail;
 	child->next = NULL;
 	
-	if (parent->children.tail != NULL)
-		parent->children.tail->next = child;
-	else
+	if (head != NULL) {
+		child->prev = head->prev;
+		head->prev->next = child;
+		head->prev = child;
+	} else {
+		child->prev = child;
 		parent->children.head = child;
-	parent->children.tail = child;
+	}
 }
 
 static void prepend_node(JsonNode *parent, JsonNode *child)
 {
+	JsonNode *head = parent->children.head;
+	
 	child->parent = parent;
-	child->prev = NULL;
-	child->next = parent->children.head;
+	child->next = head;
 	
-	if (parent->children.head != NULL)
-		parent->children.head->prev = child;
-	else
-		parent->children.tail = child;
+	if (head != NULL) {
+		child->prev = head->prev;
+		head->prev = child;
+	} else {
+		child->prev = child;
+	}
 	parent->children.head = child;
 }
 
@@ -603,14 +813,17 @@ void json_remove_from_parent(JsonNode *node)
 	JsonNode *parent = node->parent;
 	
 	if (parent != NULL) {
-		if (node->prev != NULL)
-			node->prev->next = node->next;
-		else
+		JsonNode *head = parent->children.head;
+		
+		if (node == head)
 			parent->children.head = node->next;
+		else
+			node->prev->next = node->next;
+		
 		if (node->next != NULL)
 			node->next->prev = node->prev;
-		else
-			parent->children.tail = node->prev;
+		else if (node != head)
+			head->prev = node->prev;
 		
 		free(node->key);
 		
@@ -620,7 +833,7 @@ void json_remove_from_parent(JsonNode *node)
 	}
 }
 
-static bool parse_value(const char **sp, JsonNode **out)
+static bool parse_value(const char **sp, JsonNode **out, JsonArena *arena)
 {
 	const char *s = *sp;
 	
@@ -628,7 +841,7 @@ static bool parse_value(const char **sp, JsonNode **out)
 		case 'n':
 			if (expect_literal(&s, "null")) {
 				if (out)
-					*out = json_mknull();
+					*out = mknode_in(arena, JSON_NULL);
 				*sp = s;
 				return true;
 			}
@@ -636,8 +849,10 @@ static bool parse_value(const char **sp, JsonNode **out)
 		
 		case 'f':
 			if (expect_literal(&s, "false")) {
-				if (out)
-					*out = json_mkbool(false);
+				if (out) {
+					*out = mknode_in(arena, JSON_BOOL);
+					(*out)->bool_ = false;
+				}
 				*sp = s;
 				return true;
 			}
@@ -645,8 +860,10 @@ static bool parse_value(const char **sp, JsonNode **out)
 		
 		case 't':
 			if (expect_literal(&s, "true")) {
-				if (out)
-					*out = json_mkbool(true);
+				if (out) {
+					*out = mknode_in(arena, JSON_BOOL);
+					(*out)->bool_ = true;
+				}
 				*sp = s;
 				return true;
 			}
@@ -654,9 +871,11 @@ static bool parse_value(const char **sp, JsonNode **out)
 		
 		case '"': {
 			char *str;
-			if (parse_string(&s, out ? &str : NULL)) {
-				if (out)
-					*out = mkstring(str);
+			if (parse_string(&s, out ? &str : NULL, arena)) {
+				if (out) {
+					*out = mknode_in(arena, JSON_STRING);
+					(*out)->string_ = str;
+				}
 				*sp = s;
 				return true;
 			}
@@ -664,14 +883,14 @@ static bool parse_value(const char **sp, JsonNode **out)
 		}
 		
 		case '[':
-			if (parse_array(&s, out)) {
+			if (parse_array(&s, out, arena)) {
 				*sp = s;
 				return true;
 			}
 			return false;
 		
 		case '{':
-			if (parse_object(&s, out)) {
+			if (parse_object(&s, out, arena)) {
 				*sp = s;
 				return true;
 			}
@@ -680,8 +899,10 @@ static bool parse_value(const char **sp, JsonNode **out)
 		default: {
 			double num;
 			if (parse_number(&s, out ? &num : NULL)) {
-				if (out)
-					*out = json_mknumber(num);
+				if (out) {
+					*out = mknode_in(arena, JSON_NUMBER);
+					(*out)->number_ = num;
+				}
 				*sp = s;
 				return true;
 			}
@@ -690,10 +911,10 @@ static bool parse_value(const char **sp, JsonNode **out)
 	}
 }
 
-static bool parse_array(const char **sp, JsonNode **out)
+static bool parse_array(const char **sp, JsonNode **out, JsonArena *arena)
 {
 	const char *s = *sp;
-	JsonNode *ret = out ? json_mkarray() : NULL;
+	JsonNode *ret = out ? mknode_in(arena, JSON_ARRAY) : NULL;
 	JsonNode *element;
 	
 	if (*s++ != '[')
@@ -706,12 +927,12 @@ static bool parse_array(const char **sp, JsonNode **out)
 	}
 	
 	for (;;) {
-		if (!parse_value(&s, out ? &element : NULL))
+		if (!parse_value(&s, out ? &element : NULL, arena))
 			goto failure;
 		skip_space(&s);
 		
 		if (out)
-			json_append_element(ret, element);
+			append_node(ret, element);
 		
 		if (*s == ']') {
 			s++;
@@ -730,14 +951,15 @@ success:
 	return true;
 
 failure:
-	json_delete(ret);
+	if (arena == NULL)
+		json_delete(ret);
 	return false;
 }
 
-static bool parse_object(const char **sp, JsonNode **out)
+static bool parse_object(const char **sp, JsonNode **out, JsonArena *arena)
 {
 	const char *s = *sp;
-	JsonNode *ret = out ? json_mkobject() : NULL;
+	JsonNode *ret = out ? mknode_in(arena, JSON_OBJECT) : NULL;
 	char *key;
 	JsonNode *value;
 	
@@ -751,7 +973,7 @@ static bool parse_object(const char **sp, JsonNode **out)
 	}
 	
 	for (;;) {
-		if (!parse_string(&s, out ? &key : NULL))
+		if (!parse_string(&s, out ? &key : NULL, arena))
 			goto failure;
 		skip_space(&s);
 		
@@ -759,8 +981,15 @@ static bool parse_object(const char **sp, JsonNode **out)
 			goto failure_free_key;
 		skip_space(&s);
 		
-		if (!parse_value(&s, out ? &value : NULL))
+		if (out && arena != NULL && arena->raw_key != NULL && strcmp(key, arena->raw_key) == 0) {
+			/* Validate the value, but leave it as text in the source. */
+			value = mknode_in(arena, JSON_RAW);
+			value->raw_ = s;
+			if (!parse_value(&s, NULL, NULL))
+				goto failure_free_key;
+		} else if (!parse_value(&s, out ? &value : NULL, arena)) {
 			goto failure_free_key;
+		}
 		skip_space(&s);
 		
 		if (out)
@@ -783,25 +1012,44 @@ success:
 	return true;
 
 failure_free_key:
-	if (out)
+	if (out && arena == NULL)
 		free(key);
 failure:
-	json_delete(ret);
+	if (arena == NULL)
+		json_delete(ret);
 	return false;
 }
 
-bool parse_string(const char **sp, char **out)
+bool parse_string(const char **sp, char **out, JsonArena *arena)
 {
 	const char *s = *sp;
 	SB sb;
 	char throwaway_buffer[4];
 		/* enough space for a UTF-8 character */
 	char *b;
+	char *start = NULL;
 	
 	if (*s++ != '"')
 		return false;
 	
-	if (out) {
+	if (out && arena != NULL) {
+		/*
+		 * Decoding never produces more bytes than it consumes,
+		 * so the raw literal length bounds the decoded length.
+		 */
+		const char *e = s;
+		
+		for (;;) {
+			e += scan_plain(e);
+			if (*e == '"' || *e == 0)
+				break;
+			if (*e == '\\' && e[1] != 0)
+				e++;
+			e++;
+		}
+		
+		start = b = (char*) arena_alloc(arena, (e - s) + 1, 1);
+	} else if (out) {
 		sb_init(&sb);
 		sb_need(&sb, 4);
 		b = sb.cur;
@@ -810,7 +1058,27 @@ bool parse_string(const char **sp, char **out)
 	}
 	
 	while (*s != '"') {
-		unsigned char c = *s++;
+		unsigned char c;
+		size_t run = scan_plain(s);
+		
+		/* Copy runs of plain ASCII in one go. */
+		if (run > 0) {
+			if (out) {
+				if (arena == NULL) {
+					sb.cur = b;
+					sb_need(&sb, (int) run + 4);
+					b = sb.cur;
+				}
+				memcpy(b, s, run);
+				b += run;
+				if (arena == NULL)
+					sb.cur = b;
+			}
+			s += run;
+			continue;
+		}
+		
+		c = *s++;
 		
 		/* Parse next character, and write it to b. */
 		if (c == '\\') {
@@ -884,23 +1152,28 @@ bool parse_string(const char **sp, char **out)
 		 * Update sb to know about the new bytes,
 		 * and set up b to write another character.
 		 */
-		if (out) {
+		if (out && arena == NULL) {
 			sb.cur = b;
 			sb_need(&sb, 4);
 			b = sb.cur;
-		} else {
+		} else if (!out) {
 			b = throwaway_buffer;
 		}
 	}
 	s++;
 	
-	if (out)
+	if (out && arena != NULL) {
+		*b = 0;
+		arena_shrink(arena, start, (b - start) + 1);
+		*out = start;
+	} else if (out) {
 		*out = sb_finish(&sb);
+	}
 	*sp = s;
 	return true;
 
 failed:
-	if (out)
+	if (out && arena == NULL)
 		sb_free(&sb);
 	return false;
 }
@@ -918,6 +1191,7 @@ failed:
 bool parse_number(const char **sp, double *out)
 {
 	const char *s = *sp;
+	bool integer = true;
 
 	/* '-'? */
 	if (*s == '-')
@@ -936,6 +1210,7 @@ bool parse_number(const char **sp, double *out)
 
 	/* ('.' [0-9]+)? */
 	if (*s == '.') {
+		integer = false;
 		s++;
 		if (!is_digit(*s))
 			return false;
@@ -946,6 +1221,7 @@ bool parse_number(const char **sp, double *out)
 
 	/* ([Ee] [+-]? [0-9]+)? */
 	if (*s == 'E' || *s == 'e') {
+		integer = false;
 		s++;
 		if (*s == '+' || *s == '-')
 			s++;
@@ -956,21 +1232,136 @@ bool parse_number(const char **sp, double *out)
 		} while (is_digit(*s));
 	}
 
-	if (out)
-		*out = strtod(*sp, NULL);
+	if (out) {
+		const char *d = *sp;
+		bool negative = (*d == '-');
+		
+		if (negative)
+			d++;
+		
+		/* Plain integers of up to 15 digits are exact in a double; skip strtod. */
+		if (integer && s - d <= 15) {
+			double num = 0;
+			
+			for (; d < s; d++)
+				num = num * 10 + (*d - '0');
+			
+			*out = negative ? -num : num;
+		} else {
+			*out = strtod(*sp, NULL);
+		}
+	}
 
 	*sp = s;
 	return true;
 }
 
+#ifdef JSON_USE_SSE2
+static int first_set_bit(unsigned int mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctz(mask);
+#else
+	int i = 0;
+	while (!(mask & 1)) {
+		mask >>= 1;
+		i++;
+	}
+	return i;
+#endif
+}
+#endif
+
+JSON_NO_SANITIZE
 static void skip_space(const char **sp)
 {
 	const char *s = *sp;
+	
+#ifdef JSON_USE_SSE2
+	/* Fast exit for the common case of no or one space. */
+	if (!is_space(*s))
+		return;
+	s++;
+	
+	while (((uintptr_t) s & 15) != 0) {
+		if (!is_space(*s)) {
+			*sp = s;
+			return;
+		}
+		s++;
+	}
+	
+	{
+		const __m128i sp_ = _mm_set1_epi8(' ');
+		const __m128i tab = _mm_set1_epi8('\t');
+		const __m128i lf = _mm_set1_epi8('\n');
+		const __m128i cr = _mm_set1_epi8('\r');
+		
+		for (;;) {
+			__m128i v = _mm_load_si128((const __m128i*) s);
+			__m128i m = _mm_or_si128(
+				_mm_or_si128(_mm_cmpeq_epi8(v, sp_), _mm_cmpeq_epi8(v, tab)),
+				_mm_or_si128(_mm_cmpeq_epi8(v, lf), _mm_cmpeq_epi8(v, cr))
+			);
+			unsigned int mask = ~(unsigned int) _mm_movemask_epi8(m) & 0xFFFF;
+			
+			if (mask != 0) {
+				s += first_set_bit(mask);
+				break;
+			}
+			s += 16;
+		}
+	}
+#else
 	while (is_space(*s))
 		s++;
+#endif
+	
 	*sp = s;
 }
 
+/*
+ * Return the length of the run of is_plain() bytes starting at @s.
+ * The run always stops at the terminating NUL.
+ */
+JSON_NO_SANITIZE
+static size_t scan_plain(const char *s)
+{
+	const char *p = s;
+	
+#ifdef JSON_USE_SSE2
+	while (((uintptr_t) p & 15) != 0) {
+		if (!is_plain(*p))
+			return p - s;
+		p++;
+	}
+	
+	{
+		/* Signed compare: bytes >= 0x80 are negative and count as < 0x20. */
+		const __m128i ctrl = _mm_set1_epi8(0x20);
+		const __m128i quote = _mm_set1_epi8('"');
+		const __m128i backslash = _mm_set1_epi8('\\');
+		
+		for (;;) {
+			__m128i v = _mm_load_si128((const __m128i*) p);
+			__m128i m = _mm_or_si128(
+				_mm_cmplt_epi8(v, ctrl),
+				_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash))
+			);
+			unsigned int mask = (unsigned int) _mm_movemask_epi8(m);
+			
+			if (mask != 0)
+				return (p - s) + first_set_bit(mask);
+			p += 16;
+		}
+	}
+#else
+	while (is_plain(*p))
+		p++;
+	return p - s;
+#endif
+}
+
 static void emit_value(SB *out, const JsonNode *node)
 {
 	assert(tag_is_valid(node->tag));
@@ -993,6 +1384,9 @@ static void emit_value(SB *out, const JsonNode *node)
 		case JSON_OBJECT:
 			emit_object(out, node);
 			break;
+		case JSON_RAW:
+			emit_raw(out, node->raw_);
+			break;
 		default:
 			assert(false);
 	}
@@ -1020,11 +1414,25 @@ void emit_value_indented(SB *out, const JsonNode *node, const char *space, int i
 		case JSON_OBJECT:
 			emit_object_indented(out, node, space, indent_level);
 			break;
+		case JSON_RAW:
+			emit_raw(out, node->raw_);
+			break;
 		default:
 			assert(false);
 	}
 }
 
+/* Copy the single JSON value starting at @raw verbatim. */
+static void emit_raw(SB *out, const char *raw)
+{
+	const char *end = raw;
+	
+	if (parse_value(&end, NULL, NULL))
+		sb_put(out, raw, end - raw);
+	else
+		sb_puts(out, "null");
+}
+
 static void emit_array(SB *out, const JsonNode *array)
 {
 	const JsonNode *element;
@@ -1241,7 +1649,7 @@ static void emit_number(SB *out, double num)
 
 static bool tag_is_valid(unsigned int tag)
 {
-	return (/* tag >= JSON_NULL && */ tag <= JSON_OBJECT);
+	return (/* tag >= JSON_NULL && */ tag <= JSON_RAW);
 }
 
 static bool number_is_valid(const char *num)
@@ -1332,21 +1740,23 @@ bool json_check(const JsonNode *node, char errmsg[256])
 			problem("string_ is NULL");
 		if (!utf8_validate(node->string_))
 			problem("string_ contains invalid UTF-8");
+	} else if (node->tag == JSON_RAW) {
+		const char *raw = node->raw_;
+		
+		if (raw == NULL)
+			problem("raw_ is NULL");
+		if (!parse_value(&raw, NULL, NULL))
+			problem("raw_ does not start with a valid JSON value");
 	} else if (node->tag == JSON_ARRAY || node->tag == JSON_OBJECT) {
 		JsonNode *head = node->children.head;
-		JsonNode *tail = node->children.tail;
 		
-		if (head == NULL || tail == NULL) {
-			if (head != NULL)
-				problem("tail is NULL, but head is not");
-			if (tail != NULL)
-				problem("head is NULL, but tail is not");
-		} else {
+		if (head != NULL) {
+			JsonNode *tail = head->prev;
 			JsonNode *child;
 			JsonNode *last = NULL;
 			
-			if (head->prev != NULL)
-				problem("First child's prev pointer is not NULL");
+			if (tail == NULL)
+				problem("First child's prev pointer is NULL");
 			
 			for (child = head; child != NULL; last = child, child = child->next) {
 				if (child == node)
@@ -1371,7 +1781,7 @@ bool json_check(const JsonNode *node, char errmsg[256])
 			}
 			
 			if (last != tail)
-				problem("tail does not match pointer found by starting at head and following next links");
+				problem("First child's prev pointer does not match the last child found by following next links");
 		}
 	}
 	
@@ -34,14 +34,17 @@ typedef enum {
 	JSON_NUMBER,
 	JSON_ARRAY,
 	JSON_OBJECT,
+	JSON_RAW,
 } JsonTag;
 
 typedef struct JsonNode JsonNode;
+typedef struct JsonArena JsonArena;
 
 struct JsonNode
 {
 	/* only if parent is an object or array (NULL otherwise) */
 	JsonNode *parent;
+	/* The first child's prev points to the last child. */
 	JsonNode *prev, *next;
 	
 	/* only if parent is an object (NULL otherwise) */
@@ -58,10 +61,13 @@ struct JsonNode
 		/* JSON_NUMBER */
 		double number_;
 		
+		/* JSON_RAW */
+		const char *raw_; /* Unparsed value inside the source text; not owned. */
+		
 		/* JSON_ARRAY */
 		/* JSON_OBJECT */
 		struct {
-			JsonNode *head, *tail;
+			JsonNode *head;
 		} children;
 	};
 };
@@ -76,6 +82,27 @@ void        json_delete         (JsonNode *node);
 
 bool        json_validate       (const char *json);
 
+/*
+ * Arena-backed decoding.
+ *
+ * Nodes and strings are bump-allocated from @arena; the resulting tree is
+ * released all at once with json_arena_free and must not be passed to
+ * json_delete, json_remove_from_parent, or any other function that frees
+ * individual nodes.
+ */
+JsonArena  *json_arena_new      (void);
+JsonNode   *json_decode_arena   (const char *json, JsonArena *arena);
+void        json_arena_free     (JsonArena *arena);
+
+/*
+ * Like json_decode_arena, but object members named @raw_key are only
+ * validated and kept as JSON_RAW nodes pointing into @json, which must
+ * outlive the tree.  json_decode_value decodes one value starting at
+ * *json (such as a raw_ pointer) and advances *json past it.
+ */
+JsonNode   *json_decode_raw     (const char *json, JsonArena *arena, const char *raw_key);
+JsonNode   *json_decode_value   (const char **json, JsonArena *arena);
+
 /*** Lookup and traversal ***/
 
 JsonNode   *json_find_element   (JsonNode *array, int index);
@@ -94,6 +121,7 @@ JsonNode *json_mknull(void);
 JsonNode *json_mkbool(bool b);
 JsonNode *json_mkstring(const char *s);
 JsonNode *json_mknumber(double n);
+JsonNode *json_mkraw(const char *raw); /* @raw is emitted verbatim and must outlive the node. */
 JsonNode *json_mkarray(void);
 JsonNode *json_mkobject(void);
 
@@ -20,36 +20,140 @@
     SOFTWARE.
 */
 
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef LOWEL_NO_THREADS
+    #include <pthread.h>
+#endif
+
+#if defined(__linux__) && !defined(LOWEL_NO_INOTIFY)
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    
+    #define LW_USE_INOTIFY
+#endif
+
 #include "../include/lowel.h"
+#include "rlgl.h"
 
 #define LW_MIN(x, y) (((x) < (y)) ? (x) : (y))
 #define LW_MAX(x, y) (((x) > (y)) ? (x) : (y))
 
+#define LW_JOURNAL_SUFFIX ".journal"
+
+#define LW_LZ_HASH_BITS 12
+#define LW_LZ_MIN_MATCH 4
+#define LW_LZ_MAX_OFFSET 65535
+
+#define LW_RAYCAST_THREAD_COUNT 4
+#define LW_RAYCAST_BATCH_MIN 256
+
+#define LW_MINIMAP_THREAD_COUNT 4
+#define LW_MINIMAP_BATCH_MIN 16
+
+#define LW_PATH_MAX_CHUNK_NODES 32
+#define LW_PATH_NO_EDGE 0xFFFF
+
 /* 
     청크 (일정하게 분할된 맵의 일부분)를 나타내는 구조체.
     
-    `data`: 청크의 타일 데이터를 나타낸다.
+    `data`:                청크의 타일 데이터를 나타내며, 개체의 타일 데이터는 이 배열에만 저장된다.
+                           타일이 없는 칸의 값은 `-1`이며, 청크가 압축되어 있을 때는 `NULL`이다.
+    `dirty`:               청크가 변경된 이후 아직 다시 계산되지 않은 데이터의 종류 (`LwDirtyFlag`)를 나타낸다.
+    `packed`:              압축된 타일 데이터를 나타내며, 청크가 압축되어 있지 않을 때는 `NULL`이다.
+    `packed_size`:         압축된 타일 데이터의 크기를 나타내며, 단위는 `바이트`이다.
+    `animated_tiles`:      애니메이션이 있는 타일의 청크 안에서의 상대적인 인덱스를 오름차순으로 나타낸다.
+    `animated_tile_count`: `animated_tiles`에 저장된 타일의 개수를 나타낸다.
+    `_animated_listed`:    라이브러리 내부에서 사용되는 변수이다.
+    `_autotiled`:          타일마다 지형의 고유 번호로 놓여 라이브러리가 고른 자동 타일인지를 나타내며, 
+                           아직 자동 타일을 고른 적이 없는 청크라면 `NULL`이다.
+    `revision`:            청크의 타일 데이터가 바뀔 때마다 새로 매겨지는 번호를 나타내며, 게임 맵 안에서 겹치지 않는다.
 */
 struct LwChunk {
     bool _valid;
     int *data;
+    int dirty;
+    unsigned char *packed;
+    int packed_size;
+    int *animated_tiles;
+    int animated_tile_count;
+    bool _animated_listed;
+    bool *_autotiled;
+    unsigned int revision;
 };
 
 /* 
     청크를 관리하는 역할을 하는 구조체.
     
-    `tilemap`:    게임 맵 전체의 타일 데이터를 나타낸다.
-    `indexes`:    다음에 그릴 모든 청크의 고유 번호를 나타낸다.
-    `temp_index`: 플레이어의 위치가 속한 청크의 고유 번호를 나타낸다.
-    `chunks`:     청크의 배열을 나타낸다.
+    `count`:         청크의 개수를 나타낸다.
+    `indexes`:       다음에 그릴 모든 청크의 고유 번호를 나타낸다.
+    `temp_index`:    플레이어의 위치가 속한 청크의 고유 번호를 나타낸다.
+    `chunks`:        청크의 배열을 나타낸다.
+    `dirty_indexes`: 변경된 청크의 고유 번호를 변경된 순서대로 나타낸다.
+    `dirty_count`:   `dirty_indexes`에 저장된 청크의 개수를 나타낸다.
+    `animated_indexes`: 애니메이션이 있는 타일을 포함하는 청크의 고유 번호를 나타낸다.
+    `animated_count`:   `animated_indexes`에 저장된 청크의 개수를 나타낸다.
 */
 typedef struct LwChunkSet {
-    int *tilemap;
+    int count;
     int *indexes;
     int temp_index;
     LwChunk *chunks;
+    int *dirty_indexes;
+    int dirty_count;
+    int *animated_indexes;
+    int animated_count;
 } LwChunkSet;
 
+/* 
+    타일셋 개체에서 하나의 타일에 적용되는 애니메이션을 나타내는 구조체.
+    
+    `tile_id`:        애니메이션이 적용되는 타일의 고유 번호를 나타내며, 타일 데이터에는 이 값이 저장된다.
+    `frames`:         프레임마다 그릴 타일의 고유 번호를 나타낸다.
+    `durations`:      프레임마다 지속 시간을 나타내며, 단위는 `밀리초`이다.
+    `frame_count`:    프레임의 개수를 나타낸다.
+    `total_duration`: 모든 프레임의 지속 시간의 합을 나타내며, 단위는 `밀리초`이다.
+    `elapsed`:        애니메이션의 한 주기 안에서 경과한 시간을 나타내며, 단위는 `밀리초`이다.
+    `current_frame`:  현재 그리고 있는 프레임의 번호를 나타낸다.
+    `changed`:        마지막으로 애니메이션을 진행시켰을 때 프레임이 바뀌었으면 `true`, 아니라면 `false`이다.
+*/
+typedef struct LwTileAnimation {
+    int tile_id;
+    int *frames;
+    int *durations;
+    int frame_count;
+    int total_duration;
+    double elapsed;
+    int current_frame;
+    bool changed;
+} LwTileAnimation;
+
+/* 자동 타일 규칙에서, 주변 타일을 확인하여 그릴 타일을 고르는 방식을 나타내는 열거형. */
+typedef enum LwAutotileMode {
+    LW_AUTOTILE_BLOB47,
+    LW_AUTOTILE_WANG16
+} LwAutotileMode;
+
+/* 
+    타일셋 개체에서 하나의 지형에 적용되는 자동 타일 규칙을 나타내는 구조체.
+    
+    `terrain_id`: 지형의 고유 번호를 나타내며, 게임 맵 데이터에는 이 값만 저장된다.
+    `mode`:       주변 타일을 확인하여 그릴 타일을 고르는 방식을 나타낸다. `LW_AUTOTILE_BLOB47`은 
+                  주변 8칸을, `LW_AUTOTILE_WANG16`은 상하좌우 4칸을 확인한다.
+    `tiles`:      주변 타일의 모양마다 그릴 타일의 고유 번호를 나타낸다.
+    `tile_count`: `tiles`의 크기를 나타내며, 값은 `47` 또는 `16`이다.
+*/
+typedef struct LwAutotileRule {
+    int terrain_id;
+    LwAutotileMode mode;
+    int *tiles;
+    int tile_count;
+} LwAutotileRule;
+
 /* 
     개체를 나타내는 구조체.
     
@@ -57,6 +161,8 @@ typedef struct LwChunkSet {
     `id`:         개체의 고유 번호이다.
     `image_path`: 이미지 파일의 경로이다.
     `texture`:    개체의 텍스처를 나타낸다.
+    `image_width`: 개체 이미지의 가로 길이 (`픽셀`)를 나타내며, 텍스처를 불러오지 않아도 알 수 있다.
+    `image_height`: 개체 이미지의 세로 길이 (`픽셀`)를 나타내며, 텍스처를 불러오지 않아도 알 수 있다.
     `width`:      개체의 가로 길이를 나타내며, 단위는 `픽셀`, `청크` 또는 `타일`이다.
     `height`:     개체의 세로 길이를 나타내며, 단위는 `픽셀`, `청크` 또는 `타일`이다.
     `auto_split`: `tileset`의 값이 `false`일 때만 적용된다. 
@@ -67,12 +173,41 @@ typedef struct LwChunkSet {
     `rotation`:   개체를 몇 도 (`deg.`)만큼 회전시킬지를 결정한다.
     `position`:   개체의 위치를 나타낸다.
     `chunkset`:   개체의 청크를 관리하는 구조체이다.
+    `dirty`:      개체가 변경된 이후 아직 다시 계산되지 않은 데이터의 종류 (`LwDirtyFlag`)를 나타낸다.
+    `loaded`:     개체의 텍스처와 타일 데이터를 이미 불러왔으면 `true`, 아니라면 `false`이다.
+    `tiledata_offset`: 아직 불러오지 않은 `tiledata`가 `map._source`의 몇 번째 바이트부터 시작하는지를 
+                       나타내며, 없다면 `-1`이다.
+    `width_shift`: 개체 텍스처의 가로 길이가 2의 거듭제곱일 때, 나눗셈 대신 사용할 비트 시프트 값을 
+                   나타낸다. 2의 거듭제곱이 아니라면 값은 `0`이다.
+    `solid_tiles`: 타일셋 개체에서 충돌 판정이 있는 타일의 고유 번호를 비트 단위로 나타낸 배열이다.
+    `solid_tile_count`: `solid_tiles`에 저장할 수 있는 타일 고유 번호의 개수를 나타낸다.
+    `opaque_tiles`: 타일셋 개체에서 빛을 가로막는 타일의 고유 번호를 비트 단위로 나타낸 배열이다.
+    `opaque_tile_count`: `opaque_tiles`에 저장할 수 있는 타일 고유 번호의 개수를 나타낸다.
+    `animations`:  타일셋 개체의 타일 애니메이션 배열을 나타낸다.
+    `animation_count`: `animations`에 저장된 애니메이션의 개수를 나타낸다.
+    `animation_lookup`: 타일의 고유 번호마다 `animations`에서의 인덱스를 나타내며, 
+                        애니메이션이 없는 타일이라면 `-1`이다.
+    `animation_lookup_size`: `animation_lookup`의 크기를 나타낸다.
+    `autotiles`:   타일셋 개체의 자동 타일 규칙 배열을 나타낸다.
+    `autotile_count`: `autotiles`에 저장된 규칙의 개수를 나타낸다.
+    `autotile_lookup`: 지형의 고유 번호마다 `autotiles`에서의 인덱스를 나타내며, 지형이 아니라면 `-1`이다.
+    `autotile_lookup_size`: `autotile_lookup`의 크기를 나타낸다.
+    `autotile_variant_lookup`: 지형에서 그리는 타일의 고유 번호마다 `autotiles`에서의 인덱스를 
+                               나타내며, 자동 타일이 아니라면 `-1`이다.
+    `autotile_variant_lookup_size`: `autotile_variant_lookup`의 크기를 나타낸다.
+    `tile_colors`: 타일셋 개체에서 `타일의 고유 번호 + 1`마다 타일의 대표 색상을 나타내며, 
+                   첫 번째 값은 타일이 없는 칸의 색상 (투명)이다. 미니맵을 처음 만들 때 계산된다.
+    `tile_color_count`: `tile_colors`에 저장된 색상의 개수를 나타낸다.
+    `_prev`:      라이브러리 내부에서 사용되는 변수이다.
+    `_next`:      라이브러리 내부에서 사용되는 변수이다.
 */
 struct LwObject {
     bool _valid;
     int id;
     char *image_path;
     Texture2D texture;
+    int image_width;
+    int image_height;
     LwMapUnit width;
     LwMapUnit height;
     bool tileset;
@@ -81,996 +216,9001 @@ struct LwObject {
     double rotation;
     Vector2 position;
     LwChunkSet chunkset;
+    int dirty;
+    bool loaded;
+    int tiledata_offset;
+    LwMapUnit width_shift;
+    uint32_t *solid_tiles;
+    int solid_tile_count;
+    uint32_t *opaque_tiles;
+    int opaque_tile_count;
+    LwTileAnimation *animations;
+    int animation_count;
+    int *animation_lookup;
+    int animation_lookup_size;
+    LwAutotileRule *autotiles;
+    int autotile_count;
+    int *autotile_lookup;
+    int autotile_lookup_size;
+    int *autotile_variant_lookup;
+    int autotile_variant_lookup_size;
+    uint32_t *tile_colors;
+    int tile_color_count;
+    int _prev;
+    int _next;
 };
 
-/* ::: 소스 파일 내부 함수 ::: */
+/* 
+    개체의 고유 번호를 관리하는 역할을 하는 구조체.
+    
+    `objects`:     게임 맵의 모든 개체를 고유 번호의 순서대로 나타낸 배열이며, 모든 레이어가 함께 사용한다.
+    `free_ids`:    사용 중이지 않은 개체의 고유 번호를 나타낸다.
+    `free_count`:  `free_ids`에 저장된 고유 번호의 개수를 나타낸다.
+    `generations`: 개체의 고유 번호가 몇 번째로 다시 사용되었는지를 나타낸다.
+*/
+struct LwObjectPool {
+    LwObject *objects;
+    int free_ids[MAX_OBJECT_COUNT];
+    int free_count;
+    unsigned short generations[MAX_OBJECT_COUNT];
+};
 
-/* 게임 맵의 `header` 노드에 포함된 데이터를 불러온다. */
-static bool LoadHeaderData(LwMap *map, JsonNode **node_current) {
-    JsonNode *node_header;
+/* 
+    정적 레이어를 미리 합성한 청크를 나타내는 구조체.
     
-    map->name = (char *) RL_CALLOC(
-        MAX_STRING_LENGTH, 
-        sizeof(char)
-    );
+    `target`: 연속된 정적 레이어들을 하나로 합성한 결과가 저장되는 렌더 텍스처이다.
+*/
+struct LwBakedChunk {
+    bool _valid;
+    RenderTexture2D target;
+};
+
+/* 
+    여러 개의 청크를 묶어서 축소한 이미지를 나타내는 구조체.
     
-    json_foreach(node_header, *node_current) {
-        if (TextIsEqual(node_header->key, "name")) {
-            if (node_header->string_ == NULL || TextLength(node_header->string_) == 0) {
-                TraceLog(
-                    LOG_ERROR, 
-                    "LOWEL: Failed to load map data: invalid value for `name` in `header`"
-                );
+    `_valid`: 이미지가 최신 상태이면 `true`, 다시 만들어야 한다면 `false`이다.
+    `target`: 축소한 이미지가 저장되는 렌더 텍스처이다. 청크 묶음에 그릴 내용이 없다면 `target.id`는 `0`이다.
+*/
+typedef struct LwLodImage {
+    bool _valid;
+    RenderTexture2D target;
+} LwLodImage;
 
-                return false;
-            }
-            
-            TextCopy(map->name, node_header->string_);
-        } else if (TextIsEqual(node_header->key, "format_version")) {
-            if (node_header->string_ == NULL || TextLength(node_header->string_) == 0) {
-                TraceLog(
-                    LOG_ERROR, 
-                    "LOWEL: Failed to load map data: invalid value for `format_version` in `header`"
-                );
+/* 
+    여러 개의 청크를 묶어서 축소한 이미지의 한 단계를 나타내는 구조체. `k`번째 단계의 이미지는 
+    가로와 세로로 `2^k`개씩의 청크를 청크 하나의 크기로 축소한 것이다.
+    
+    `width`:  가로 방향의 청크 묶음 개수를 나타낸다.
+    `height`: 세로 방향의 청크 묶음 개수를 나타낸다.
+    `images`: 청크 묶음마다 축소한 이미지의 배열을 나타내며, 처음 사용할 때 할당된다.
+*/
+struct LwLodLevel {
+    int width;
+    int height;
+    LwLodImage *images;
+};
 
-                return false;
-            } else if (!TextIsEqual(node_header->string_, MAP_FORMAT_VERSION)) {
-                TraceLog(
-                    LOG_ERROR, 
-                    "LOWEL: Failed to load map data: map format version mismatch"
-                );
+/* 
+    게임 맵의 전장의 안개를 나타내는 구조체. 청크마다 타일 하나를 비트 하나로 나타내며, 
+    청크 안에서의 상대적인 타일 인덱스 순서대로 비트를 저장한다.
+    
+    `chunk_words`:     청크 하나의 비트 배열에 필요한 워드의 개수를 나타낸다.
+    `explored`:        청크마다 한 번이라도 본 적이 있는 타일을 나타내는 비트 배열이다.
+    `visible`:         청크마다 지금 보이는 타일을 나타내는 비트 배열이다.
+    `explored_counts`: 청크마다 `explored`에 표시된 타일의 개수를 나타낸다.
+    `visible_indexes`: `visible`에 표시된 타일이 있는 청크의 고유 번호를 나타낸다.
+    `visible_count`:   `visible_indexes`에 저장된 청크의 개수를 나타낸다.
+    `visible_listed`:  청크마다 `visible_indexes`에 이미 저장되었는지를 나타낸다.
+*/
+struct LwFog {
+    int chunk_words;
+    uint32_t *explored;
+    uint32_t *visible;
+    int *explored_counts;
+    int *visible_indexes;
+    int visible_count;
+    bool *visible_listed;
+};
 
-                return false;
-            }
-        }
+/* 
+    빛이 나오는 타일을 나타내는 구조체.
+    
+    `position`: 빛이 나오는 타일의 타일 기준 좌표를 나타낸다.
+    `level`:    빛의 밝기를 나타내며, 범위는 `[1, MAX_LIGHT_LEVEL]`이다.
+*/
+typedef struct LwLightSource {
+    LwTileCoord position;
+    int level;
+} LwLightSource;
+
+/* 
+    빛을 지울 타일을 나타내는 구조체.
+    
+    `index`: 빛을 지울 타일의 인덱스 (`y * width + x`)를 나타낸다.
+    `level`: 빛을 지우기 전의 밝기를 나타낸다.
+*/
+typedef struct LwLightRemoval {
+    int index;
+    int level;
+} LwLightRemoval;
+
+/* 
+    게임 맵의 조명을 나타내는 구조체. 빛은 상하좌우로 한 칸 퍼질 때마다 밝기가 1씩 줄어든다.
+    
+    `levels`:           타일마다 밝기를 나타낸다. 청크의 고유 번호 순서대로, 청크 안에서의 상대적인 
+                        타일 인덱스 순서대로 저장한다.
+    `opaque`:           빛을 가로막는 타일을 타일마다 1비트씩 나타내며, 순서는 `map._solid`와 같다.
+    `sources`:          빛이 나오는 타일의 배열을 나타낸다.
+    `source_count`:     `sources`에 저장된 타일의 개수를 나타낸다.
+    `source_capacity`:  `sources`에 저장할 수 있는 타일의 최대 개수를 나타낸다.
+    `queue`:            빛을 퍼뜨릴 타일의 인덱스 (`y * width + x`)를 나타낸다.
+    `queue_count`:      `queue`에 저장된 타일의 개수를 나타낸다.
+    `queue_capacity`:   `queue`에 저장할 수 있는 타일의 최대 개수를 나타낸다.
+    `removals`:         빛을 지울 타일의 배열을 나타낸다.
+    `removal_count`:    `removals`에 저장된 타일의 개수를 나타낸다.
+    `removal_capacity`: `removals`에 저장할 수 있는 타일의 최대 개수를 나타낸다.
+    `changed_indexes`:  밝기가 바뀐 타일이 있는 청크의 고유 번호를 나타낸다.
+    `changed_count`:    `changed_indexes`에 저장된 청크의 개수를 나타낸다.
+    `changed_listed`:   청크마다 `changed_indexes`에 이미 저장되었는지를 나타낸다.
+    `ambient`:          빛이 닿지 않는 타일에도 적용되는 최소 밝기를 나타낸다.
+*/
+struct LwLight {
+    uint8_t *levels;
+    uint32_t *opaque;
+    LwLightSource *sources;
+    int source_count;
+    int source_capacity;
+    int *queue;
+    int queue_count;
+    int queue_capacity;
+    LwLightRemoval *removals;
+    int removal_count;
+    int removal_capacity;
+    int *changed_indexes;
+    int changed_count;
+    bool *changed_listed;
+    int ambient;
+};
+
+/* 
+    게임 맵 파일의 변경을 감지하는 구조체.
+    
+    `path`:     감시하는 게임 맵 파일의 경로를 나타낸다.
+    `mod_time`: 마지막으로 확인한 게임 맵 파일의 수정 시각을 나타낸다.
+    `fd`:       게임 맵 파일이 있는 디렉토리를 감시하는 `inotify` 인스턴스를 나타내며, 
+                사용할 수 없다면 `-1`이다. 이때는 수정 시각을 비교하여 변경을 감지한다.
+*/
+struct LwMapWatch {
+    char *path;
+    long mod_time;
+    int fd;
+};
+
+/* 
+    HPA* 방식의 경로 탐색에서, 청크의 경계에 있는 출입구와 출입구 사이의 거리를 나타내는 구조체.
+    출입구는 이웃한 두 청크의 경계에서 양쪽 모두 지나갈 수 있는 타일이 연속된 구간마다, 
+    구간의 가운데에 하나씩 놓인다.
+    
+    `chunk_count`: 청크의 개수를 나타낸다.
+    `node_tiles`:  청크마다 최대 `LW_PATH_MAX_CHUNK_NODES`개의 출입구 타일의 인덱스를 나타낸다.
+    `node_sides`:  출입구가 청크의 어느 쪽 경계에 있는지를 나타내며, 순서대로 왼쪽, 오른쪽, 위쪽, 
+                   아래쪽 경계를 뜻하는 `0`, `1`, `2`, `3` 중 하나이다.
+    `node_counts`: 청크마다 출입구의 개수를 나타낸다.
+    `distances`:   청크마다 청크 안에서 출입구 사이를 이동하는 거리를 나타내며, 
+                   갈 수 없다면 `LW_PATH_NO_EDGE`이다.
+    `stale`:       청크마다 출입구를 다시 계산해야 하는지를 나타낸다.
+*/
+struct LwPathGraph {
+    int chunk_count;
+    int *node_tiles;
+    unsigned char *node_sides;
+    int *node_counts;
+    unsigned short *distances;
+    bool *stale;
+};
+
+/* 
+    경로 탐색에 필요한 메모리를 미리 할당해두고 다시 사용하는 구조체.
+    
+    `map`:            경로를 탐색할 게임 맵을 나타낸다.
+    `tile_count`:     게임 맵의 타일 개수를 나타낸다.
+    `node_count`:     추상 그래프의 노드 개수를 나타내며, 마지막 두 노드는 출발점과 도착점이다.
+    `generation`:     탐색할 때마다 증가하며, `*_stamps`와 같을 때만 탐색 데이터가 유효하다.
+    `tile_stamps`:    타일마다 마지막으로 방문한 탐색의 `generation`을 나타낸다.
+    `tile_costs`:     타일마다 탐색을 시작한 타일로부터의 거리를 나타낸다.
+    `tile_parents`:   타일마다 탐색 경로에서 바로 이전 타일의 인덱스를 나타낸다.
+    `queue`:          너비 우선 탐색에 사용되는 큐를 나타낸다.
+    `flow_costs`:     흐름 필드에서 타일마다 목적지까지의 거리를 나타낸다.
+    `node_stamps`:    노드마다 마지막으로 방문한 탐색의 `generation`을 나타낸다.
+    `node_costs`:     노드마다 출발점으로부터의 거리를 나타낸다.
+    `node_scores`:    노드마다 출발점으로부터의 거리와 도착점까지의 추정 거리의 합을 나타낸다.
+    `node_parents`:   노드마다 탐색 경로에서 바로 이전 노드를 나타낸다.
+    `node_order`:     찾은 노드 경로를 순서대로 나타낸다.
+    `heap`:           열린 목록으로 사용되는 이진 힙을 나타낸다.
+    `heap_positions`: 노드마다 이진 힙에서의 위치를 나타내며, 힙에 없다면 `-1`이다.
+    `heap_size`:      이진 힙에 들어 있는 노드의 개수를 나타낸다.
+    `start_costs`:    출발점이 속한 청크의 출입구마다 출발점으로부터의 거리를 나타낸다.
+    `goal_costs`:     도착점이 속한 청크의 출입구마다 도착점까지의 거리를 나타낸다.
+*/
+struct LwPathContext {
+    LwMap *map;
+    int tile_count;
+    int node_count;
+    unsigned int generation;
+    unsigned int *tile_stamps;
+    int *tile_costs;
+    int *tile_parents;
+    int *queue;
+    int *flow_costs;
+    unsigned int *node_stamps;
+    int *node_costs;
+    int *node_scores;
+    int *node_parents;
+    int *node_order;
+    int *heap;
+    int *heap_positions;
+    int heap_size;
+    int start_costs[LW_PATH_MAX_CHUNK_NODES];
+    int goal_costs[LW_PATH_MAX_CHUNK_NODES];
+};
+
+/* 
+    여러 스레드에서 같은 게임 맵을 동시에 읽을 때, 스레드마다 따로 사용하는 구조체.
+    
+    `map`:             타일을 읽을 게임 맵을 나타낸다.
+    `buffer`:          압축된 청크의 압축을 풀어서 저장하는 버퍼를 나타낸다.
+    `buffer_object`:   `buffer`에 저장된 청크를 가진 개체를 나타낸다.
+    `buffer_index`:    `buffer`에 저장된 청크의 고유 번호를 나타내며, 없다면 `-1`이다.
+    `buffer_packed`:   `buffer`에 압축을 푼 원본 데이터를 나타낸다.
+    `buffer_revision`: `buffer`에 압축을 풀 때 청크의 `revision`을 나타낸다.
+*/
+struct LwQueryContext {
+    LwMap *map;
+    int *buffer;
+    LwObject *buffer_object;
+    int buffer_index;
+    const unsigned char *buffer_packed;
+    unsigned int buffer_revision;
+};
+
+/* 월드를 구성하는 격자의 한 칸에 있는 게임 맵을 불러온 상태를 나타내는 열거형. */
+typedef enum LwWorldCellState {
+    LW_WORLD_CELL_UNLOADED,
+    LW_WORLD_CELL_LOADING,
+    LW_WORLD_CELL_READY,
+    LW_WORLD_CELL_FAILED
+} LwWorldCellState;
+
+/* 
+    월드를 구성하는 격자의 한 칸을 나타내는 구조체.
+    
+    `path`:   게임 맵 파일의 경로이며, 게임 맵이 없는 칸이라면 `NULL`이다.
+    `map`:    게임 맵 데이터를 나타낸다.
+    `state`:  게임 맵을 불러온 상태를 나타낸다.
+    `result`: 백그라운드에서 게임 맵 데이터를 불러오는 데 성공했으면 `true`, 아니라면 `false`이다.
+    `done`:   백그라운드에서 게임 맵 데이터를 불러오는 작업이 끝났으면 `true`, 아니라면 `false`이다.
+    `threaded`: 게임 맵 데이터를 별도의 스레드에서 불러오고 있으면 `true`, 아니라면 `false`이다.
+    `thread`: 게임 맵 데이터를 불러오는 스레드를 나타낸다.
+    `lock`:   `result`와 `done`에 접근할 때 사용하는 뮤텍스이다.
+*/
+struct LwWorldCell {
+    char *path;
+    LwMap map;
+    LwWorldCellState state;
+    bool result;
+    bool done;
+    bool threaded;
+#ifndef LOWEL_NO_THREADS
+    pthread_t thread;
+    pthread_mutex_t lock;
+#endif
+};
+
+/* 게임 맵 데이터에서 사용되는 JSON 키의 종류를 나타내는 열거형. */
+typedef enum LwKey {
+    LW_KEY_UNKNOWN,
+    LW_KEY_X,
+    LW_KEY_Y,
+    LW_KEY_ID,
+    LW_KEY_NAME,
+    LW_KEY_WIDTH,
+    LW_KEY_IMAGE,
+    LW_KEY_HEIGHT,
+    LW_KEY_STATIC,
+    LW_KEY_OBJECTS,
+    LW_KEY_TILESET,
+    LW_KEY_POSITION,
+    LW_KEY_TILEDATA,
+    LW_KEY_SCALE_MUL,
+    LW_KEY_TILE_WIDTH,
+    LW_KEY_AUTO_SPLIT,
+    LW_KEY_TILE_HEIGHT,
+    LW_KEY_ROTATION_DEG,
+    LW_KEY_CHUNK_WIDTH_T,
+    LW_KEY_FORMAT_VERSION,
+    LW_KEY_CHUNK_HEIGHT_T,
+    LW_KEY_DRAW_DISTANCE_C,
+    LW_KEY_PATH,
+    LW_KEY_MAP_WIDTH,
+    LW_KEY_MAP_HEIGHT,
+    LW_KEY_LOAD_DISTANCE_M,
+    LW_KEY_SOLID_TILES,
+    LW_KEY_FRAMES,
+    LW_KEY_ANIMATIONS,
+    LW_KEY_DURATION_MS,
+    LW_KEY_MODE,
+    LW_KEY_TILES,
+    LW_KEY_AUTOTILES,
+    LW_KEY_PARALLAX,
+    LW_KEY_OPAQUE_TILES,
+    LW_KEY_IMAGE_WIDTH,
+    LW_KEY_IMAGE_HEIGHT,
+    LW_KEY_COUNT
+} LwKey;
+
+/* ::: 소스 파일 내부 함수 ::: */
+
+/* 
+    JSON 키 `key`의 종류를 반환한다. 
+    
+    키의 길이와 첫 글자만으로 후보를 하나로 좁힌 다음, 그 후보와 한 번만 비교한다.
+*/
+static LwKey GetKeyType(const char *key) {
+    static const char *key_names[LW_KEY_COUNT] = {
+        [LW_KEY_X] = "x",
+        [LW_KEY_Y] = "y",
+        [LW_KEY_ID] = "id",
+        [LW_KEY_NAME] = "name",
+        [LW_KEY_WIDTH] = "width",
+        [LW_KEY_IMAGE] = "image",
+        [LW_KEY_HEIGHT] = "height",
+        [LW_KEY_STATIC] = "static",
+        [LW_KEY_OBJECTS] = "objects",
+        [LW_KEY_TILESET] = "tileset",
+        [LW_KEY_POSITION] = "position",
+        [LW_KEY_TILEDATA] = "tiledata",
+        [LW_KEY_SCALE_MUL] = "scale_mul",
+        [LW_KEY_TILE_WIDTH] = "tile_width",
+        [LW_KEY_AUTO_SPLIT] = "auto_split",
+        [LW_KEY_TILE_HEIGHT] = "tile_height",
+        [LW_KEY_ROTATION_DEG] = "rotation_deg",
+        [LW_KEY_CHUNK_WIDTH_T] = "chunk_width_t",
+        [LW_KEY_FORMAT_VERSION] = "format_version",
+        [LW_KEY_CHUNK_HEIGHT_T] = "chunk_height_t",
+        [LW_KEY_DRAW_DISTANCE_C] = "draw_distance_c",
+        [LW_KEY_PATH] = "path",
+        [LW_KEY_MAP_WIDTH] = "map_width",
+        [LW_KEY_MAP_HEIGHT] = "map_height",
+        [LW_KEY_LOAD_DISTANCE_M] = "load_distance_m",
+        [LW_KEY_SOLID_TILES] = "solid_tiles",
+        [LW_KEY_FRAMES] = "frames",
+        [LW_KEY_ANIMATIONS] = "animations",
+        [LW_KEY_DURATION_MS] = "duration_ms",
+        [LW_KEY_MODE] = "mode",
+        [LW_KEY_TILES] = "tiles",
+        [LW_KEY_AUTOTILES] = "autotiles",
+        [LW_KEY_PARALLAX] = "parallax",
+        [LW_KEY_OPAQUE_TILES] = "opaque_tiles",
+        [LW_KEY_IMAGE_WIDTH] = "image_width",
+        [LW_KEY_IMAGE_HEIGHT] = "image_height"
+    };
+    
+    LwKey result = LW_KEY_UNKNOWN;
+    
+    size_t length;
+    
+    if (key == NULL)
+        return LW_KEY_UNKNOWN;
+    
+    length = strlen(key);
+    
+    switch (length) {
+        case 1:
+            result = (key[0] == 'x') ? LW_KEY_X : LW_KEY_Y;
+            break;
+            
+        case 2:
+            result = LW_KEY_ID;
+            break;
+            
+        case 4:
+            if (key[0] == 'n')
+                result = LW_KEY_NAME;
+            else 
+                result = (key[0] == 'p') ? LW_KEY_PATH : LW_KEY_MODE;
+            
+            break;
+            
+        case 5:
+            if (key[0] == 'w')
+                result = LW_KEY_WIDTH;
+            else 
+                result = (key[0] == 'i') ? LW_KEY_IMAGE : LW_KEY_TILES;
+            
+            break;
+            
+        case 6:
+            if (key[0] == 'h')
+                result = LW_KEY_HEIGHT;
+            else 
+                result = (key[0] == 'f') ? LW_KEY_FRAMES : LW_KEY_STATIC;
+            
+            break;
+            
+        case 7:
+            result = (key[0] == 'o') ? LW_KEY_OBJECTS : LW_KEY_TILESET;
+            break;
+            
+        case 8:
+            if (key[0] == 'p')
+                result = (key[1] == 'o') ? LW_KEY_POSITION : LW_KEY_PARALLAX;
+            else
+                result = LW_KEY_TILEDATA;
+            
+            break;
+            
+        case 9:
+            if (key[0] == 's')
+                result = LW_KEY_SCALE_MUL;
+            else 
+                result = (key[0] == 'm') ? LW_KEY_MAP_WIDTH : LW_KEY_AUTOTILES;
+            
+            break;
+            
+        case 10:
+            if (key[0] == 't')
+                result = LW_KEY_TILE_WIDTH;
+            else if (key[0] == 'a')
+                result = (key[1] == 'u') ? LW_KEY_AUTO_SPLIT : LW_KEY_ANIMATIONS;
+            else 
+                result = LW_KEY_MAP_HEIGHT;
+            
+            break;
+            
+        case 11:
+            if (key[0] == 't')
+                result = LW_KEY_TILE_HEIGHT;
+            else if (key[0] == 'i')
+                result = LW_KEY_IMAGE_WIDTH;
+            else 
+                result = (key[0] == 's') ? LW_KEY_SOLID_TILES : LW_KEY_DURATION_MS;
+            
+            break;
+            
+        case 12:
+            if (key[0] == 'r')
+                result = LW_KEY_ROTATION_DEG;
+            else 
+                result = (key[0] == 'i') ? LW_KEY_IMAGE_HEIGHT : LW_KEY_OPAQUE_TILES;
+            
+            break;
+            
+        case 13:
+            result = LW_KEY_CHUNK_WIDTH_T;
+            break;
+            
+        case 14:
+            result = (key[0] == 'f') ? LW_KEY_FORMAT_VERSION : LW_KEY_CHUNK_HEIGHT_T;
+            break;
+            
+        case 15:
+            result = (key[0] == 'd') ? LW_KEY_DRAW_DISTANCE_C : LW_KEY_LOAD_DISTANCE_M;
+            break;
     }
     
-    *node_current = (*node_current)->next;
+    if (result == LW_KEY_UNKNOWN || memcmp(key, key_names[result], length) != 0)
+        return LW_KEY_UNKNOWN;
     
-    return true;
+    return result;
 }
 
-/* 게임 맵의 `options` 노드에 포함된 데이터를 불러온다. */
-static bool LoadOptionsData(LwMap *map, JsonNode **node_current) {
-    JsonNode *node_options;
+/* 부호 없는 정수 `value`를 가변 길이 정수로 변환하여 `output`에 저장하고, 저장된 바이트 수를 반환한다. */
+static int WriteVarint(unsigned char *output, unsigned int value) {
+    int length = 0;
     
-    json_foreach(node_options, *node_current) {
-        if (TextIsEqual(node_options->key, "width")) {
-            map->width.px = (int) node_options->number_;
-        } else if (TextIsEqual(node_options->key, "height")) {
-            map->height.px = (int) node_options->number_; 
-        } else if (TextIsEqual(node_options->key, "tile_width")) {
-            map->tile_width = (int) node_options->number_;
-        } else if (TextIsEqual(node_options->key, "tile_height")) {
-            map->tile_height = (int) node_options->number_;
-        } else if (TextIsEqual(node_options->key, "chunk_width_t")) {
-            map->chunk_width = (int) node_options->number_; 
-        } else if (TextIsEqual(node_options->key, "chunk_height_t")) {
-            map->chunk_height = (int) node_options->number_;
-        } else if (TextIsEqual(node_options->key, "draw_distance_c")) {
-            map->draw_distance = (int) node_options->number_;
-        }
+    while (value >= 0x80) {
+        output[length++] = (unsigned char) (value | 0x80);
+        
+        value >>= 7;
     }
     
-    if (map->width.px <= 0 || map->height.px <= 0
-       || map->tile_width <= 0 || map->tile_height <= 0
-       || map->chunk_width <= 0 || map->chunk_height <= 0) {
-        TraceLog(
-            LOG_ERROR, 
-            "LOWEL: [MAP '%s'] Failed to load map data: "
-            "the value of width/height property must not be negative",
-            map->name
-        );
+    output[length++] = (unsigned char) value;
+    
+    return length;
+}
+
+/* `input`에서 가변 길이 정수를 읽어 `value`에 저장하고, 읽은 바이트 수를 반환한다. */
+static int ReadVarint(const unsigned char *input, int size, unsigned int *value) {
+    *value = 0;
+    
+    for (int i = 0, shift = 0; i < size && shift < 32; i++, shift += 7) {
+        *value |= (unsigned int) (input[i] & 0x7F) << shift;
         
-        return false;
+        if (!(input[i] & 0x80))
+            return i + 1;
     }
     
-    if (map->draw_distance < 0) {
-        TraceLog(
-            LOG_ERROR, 
-            "LOWEL: [MAP '%s'] Failed to load map data: "
-            "the value of `draw_distance` must not be negative",
-            map->name
-        );
+    return 0;
+}
+
+/* 
+    타일 데이터 `data`를 `(타일의 고유 번호, 반복 횟수)` 쌍으로 압축하여 `output`에 저장하고, 
+    압축된 데이터의 크기를 반환한다. `output`의 크기는 `count * 10` 바이트 이상이어야 한다.
+*/
+static int EncodeRLE(const int *data, int count, unsigned char *output) {
+    int length = 0, run;
+    
+    for (int i = 0; i < count; i += run) {
+        for (run = 1; (i + run) < count && data[i + run] == data[i]; run++);
         
-        return false;
-    } else if (map->draw_distance > MAX_DRAW_DISTANCE) {
-        TraceLog(
-            LOG_WARNING, 
-            "LOWEL: [MAP '%s'] The value of `draw_distance` must be less than or equal to %d",
-            map->name,
-            MAX_DRAW_DISTANCE
+        /* 빈 칸을 나타내는 `-1`도 짧게 저장할 수 있도록, 지그재그 인코딩을 사용한다. */
+        length += WriteVarint(
+            output + length, 
+            ((unsigned int) data[i] << 1) ^ (unsigned int) (data[i] >> 31)
         );
-        TraceLog(
-            LOG_WARNING, 
-            "LOWEL: [MAP '%s'] Setting the value of `draw_distance` to %d automatically",
-            map->name,
-            MAX_DRAW_DISTANCE
-        );
-        
-        map->draw_distance = 16;
+        length += WriteVarint(output + length, (unsigned int) run);
     }
     
-    map->width.t = map->width.px / map->tile_width; 
-    map->height.t = map->height.px / map->tile_height;
-    
-    map->width.c = (map->width.t % map->chunk_width) 
-        ? (map->width.t / map->chunk_width) + 1
-        : (map->width.t / map->chunk_width);
-    map->height.c = (map->height.t % map->chunk_height)
-        ? (map->height.t / map->chunk_height) + 1
-        : (map->height.t / map->chunk_height);
-    
-    *node_current = (*node_current)->next;
-    
-    return true;
+    return length;
 }
 
-/* 개체의 타일 데이터를 청크 배열로 변환하여, `object.chunkset.chunks`에 저장한다. */
-static bool LoadTileData(LwMap *map, LwObject *object, int *tiledata) {
-    int chunk_index, relative_tile_index;
+/* `EncodeRLE()`로 압축된 데이터 `input`을 타일 `count`개의 타일 데이터로 변환하여 `data`에 저장한다. */
+static bool DecodeRLE(const unsigned char *input, int size, int *data, int count) {
+    unsigned int value, run;
     
-    if (!object->tileset && !object->auto_split) {
-        return true;
-    } else if (object->tileset && !object->auto_split) {
-        object->position = (Vector2) { 0 };
+    int offset = 0, tile_index = 0, length;
+    
+    while (offset < size) {
+        if ((length = ReadVarint(input + offset, size - offset, &value)) == 0)
+            return false;
         
-        object->chunkset.tilemap = (int *) RL_CALLOC(
-            map->width.t * map->height.t,
-            sizeof(int)
-        );
+        offset += length;
         
-        for (int i = 0; i < map->width.t * map->height.t; i++)
-            object->chunkset.tilemap[i] = tiledata[i];
+        if ((length = ReadVarint(input + offset, size - offset, &run)) == 0)
+            return false;
         
-        RL_FREE(tiledata);
+        offset += length;
         
-        object->chunkset.indexes = (int *) RL_CALLOC(
-            GetAdjacentChunkCount(map),
-            sizeof(int)
-        );
+        if (run > (unsigned int) (count - tile_index))
+            return false;
         
-        object->chunkset.temp_index = -1;
+        for (unsigned int i = 0; i < run; i++)
+            data[tile_index++] = (int) (value >> 1) ^ -(int) (value & 1);
+    }
+    
+    return (tile_index == count);
+}
+
+/* LZ 계열 압축 데이터의 길이 정보를 `output`에 저장하고, 저장된 바이트 수를 반환한다. */
+static int WriteLZLength(unsigned char *output, int length) {
+    int offset = 0;
+    
+    for (; length >= 255; length -= 255)
+        output[offset++] = 255;
+    
+    output[offset++] = (unsigned char) length;
+    
+    return offset;
+}
+
+/* 
+    LZ4와 비슷한 방식으로 `input`을 압축하여 `output`에 저장하고, 압축된 데이터의 크기를 반환한다.
+    `output`의 크기는 `size + (size / 255) + 16` 바이트 이상이어야 한다.
+*/
+static int CompressLZ(const unsigned char *input, int size, unsigned char *output) {
+    int table[1 << LW_LZ_HASH_BITS];
+    
+    int input_index = 0, anchor = 0, length = 0;
+    int literal_length, match_length, reference;
+    
+    unsigned int sequence, hash;
+    
+    unsigned char *token;
+    
+    for (int i = 0; i < (1 << LW_LZ_HASH_BITS); i++)
+        table[i] = -1;
+    
+    while (input_index + LW_LZ_MIN_MATCH <= size) {
+        memcpy(&sequence, input + input_index, sizeof(sequence));
         
-        object->chunkset.chunks = (LwChunk *) RL_CALLOC(
-            map->width.c * map->height.c,
-            sizeof(LwChunk)
-        );
+        hash = (sequence * 2654435761U) >> (32 - LW_LZ_HASH_BITS);
         
-        for (int i = 0; i < (map->width.c * map->height.c); i++)
-            object->chunkset.chunks[i].data = (int *) RL_CALLOC(
-                map->chunk_width * map->chunk_height,
-                sizeof(int)
-            );
+        reference = table[hash];
+        table[hash] = input_index;
         
-        for (int abs_tile_index = 0; 
-             abs_tile_index < (map->width.t * map->height.t);
-             abs_tile_index++) {
-            if (object->chunkset.tilemap[abs_tile_index] < 0)
-                continue;
-            
-            chunk_index = TileIndexToChunkIndexMap(map, abs_tile_index);
-            relative_tile_index = (((abs_tile_index / map->width.t) % map->chunk_width) * map->chunk_width)
-                + ((abs_tile_index % map->width.t) % map->chunk_width);
+        if (reference < 0 || (input_index - reference) > LW_LZ_MAX_OFFSET
+            || memcmp(input + reference, input + input_index, LW_LZ_MIN_MATCH) != 0) {
+            input_index++;
             
-            if (!object->chunkset.chunks[chunk_index]._valid)
-                object->chunkset.chunks[chunk_index]._valid = true;
-            
-            object->chunkset.chunks[chunk_index]
-                .data[relative_tile_index] = object->chunkset.tilemap[abs_tile_index];
+            continue;
         }
         
-        return true;
-    } else if (!object->tileset && object->auto_split) {
-        object->chunkset.tilemap = (int *) RL_CALLOC(
-            object->width.t * object->height.t,
-            sizeof(int)
-        );
+        for (match_length = LW_LZ_MIN_MATCH; 
+             (input_index + match_length) < size 
+             && input[reference + match_length] == input[input_index + match_length];
+             match_length++);
         
-        for (int i = 0; i < object->width.t * object->height.t; i++)
-            object->chunkset.tilemap[i] = i;
+        literal_length = input_index - anchor;
         
-        object->chunkset.indexes = (int *) RL_CALLOC(
-            GetAdjacentChunkCount(map),
-            sizeof(int)
-        );
+        token = &output[length++];
         
-        object->chunkset.temp_index = -1;
+        *token = (unsigned char) ((LW_MIN(literal_length, 15) << 4) 
+            | LW_MIN(match_length - LW_LZ_MIN_MATCH, 15));
         
-        object->chunkset.chunks = (LwChunk *) RL_CALLOC(
-            object->width.c * object->height.c,
-            sizeof(LwChunk)
-        );
+        if (literal_length >= 15)
+            length += WriteLZLength(output + length, literal_length - 15);
         
-        for (int i = 0; i < (object->width.c * object->height.c); i++)
-            object->chunkset.chunks[i].data = (int *) RL_CALLOC(
-                map->chunk_width * map->chunk_height,
-                sizeof(int)
-            );
+        memcpy(output + length, input + anchor, literal_length);
         
-        for (int abs_tile_index = 0; 
-             abs_tile_index < (object->width.t * object->height.t); 
-             abs_tile_index++) {
-            if (object->chunkset.tilemap[abs_tile_index] < 0)
-                continue;
-            
-            chunk_index = TileIndexToChunkIndexObject(map, object, abs_tile_index);
-            relative_tile_index = (((abs_tile_index / object->width.t) % map->chunk_width) * map->chunk_width)
-                + ((abs_tile_index % object->width.t) % map->chunk_width);
-            
-            if (!object->chunkset.chunks[chunk_index]._valid)
-                object->chunkset.chunks[chunk_index]._valid = true;
-            
-            object->chunkset.chunks[chunk_index]
-                .data[relative_tile_index] = object->chunkset.tilemap[abs_tile_index];
-        }
+        length += literal_length;
         
-        return true;
-    } else {
-        return false;
+        output[length++] = (unsigned char) ((input_index - reference) & 0xFF);
+        output[length++] = (unsigned char) ((input_index - reference) >> 8);
+        
+        if (match_length - LW_LZ_MIN_MATCH >= 15)
+            length += WriteLZLength(output + length, match_length - LW_LZ_MIN_MATCH - 15);
+        
+        input_index += match_length;
+        anchor = input_index;
     }
-}
-
-/* 게임 맵 레이어의 `objects` 노드에 포함된 데이터를 불러온다. */
-static bool LoadObjectsData(LwMap *map, JsonNode *node_layer, int layer_id) {
-    JsonNode *node_objects, *node_object;
-    JsonNode *node_offset, *node_tiledata;
     
-    LwObject *object;
+    /* 마지막 부분은 반복되는 부분 없이 원본 데이터만 저장한다. */
+    literal_length = size - anchor;
     
-    int *tiledata;
+    output[length++] = (unsigned char) (LW_MIN(literal_length, 15) << 4);
     
-    int object_id = -1;
-    int tile_index = 0;
+    if (literal_length >= 15)
+        length += WriteLZLength(output + length, literal_length - 15);
     
-    map->object_table = (int *) RL_CALLOC(
-        MAX_OBJECT_COUNT,
-        sizeof(int)
-    );
+    memcpy(output + length, input + anchor, literal_length);
     
-    json_foreach(node_objects, node_layer) {
-        json_foreach(node_object, node_objects) {
-            if (TextIsEqual(node_object->key, "id")) {
-                object_id = (int) node_object->number_;
-                
-                map->object_table[object_id] = layer_id;
-                                    
-                map->layers[layer_id].objects[object_id]._valid = true;
-                map->layers[layer_id].objects[object_id].id = object_id;
-            } else {
-                object = &map->layers[layer_id].objects[object_id];
-                
-                if (object_id < 0 || object_id > MAX_OBJECT_COUNT - 1) {
-                    TraceLog(
-                        LOG_ERROR, 
-                        "LOWEL: [MAP '%s'] Failed to load map data: invalid value "
-                        "for `object_id` in `objects`",
-                        map->name
-                    );
-
-                    return false;
-                } else {
-                    if (TextIsEqual(node_object->key, "image")) {
-                        object->image_path = (char *) RL_CALLOC(
-                            MAX_STRING_LENGTH,
-                            sizeof(char)
-                        );
-
-                        TextCopy(object->image_path, node_object->string_);
-
-                        if (map->load_texture != NULL) {
-                            TraceLog(
-                                LOG_INFO, 
-                                "LOWEL: [MAP '%s': %s] Attempting to load texture for object #%d",
-                                map->name,
-                                object->image_path,
-                                object_id
-                            );
-
-                            map->layers[layer_id].objects[object_id].texture = map->load_texture(
-                                object->image_path
-                            );
-                        }
-                    } else if (TextIsEqual(node_object->key, "tileset")) {
-                        object->tileset = node_object->bool_;
-                    } else if (TextIsEqual(node_object->key, "auto_split")) {
-                        object->auto_split = node_object->bool_;
-                    } else if (TextIsEqual(node_object->key, "scale_mul")) {
-                        object->scale = node_object->number_;
-                        
-                        object->width.px = object->texture.width * object->scale;
-                        object->height.px = object->texture.height * object->scale;
-
-                        object->width.t = object->width.px / map->tile_width;
-                        object->height.t = object->height.px / map->tile_height;
-
-                        object->width.c = (object->width.t % map->chunk_width) 
-                            ? (object->width.t / map->chunk_width) + 1
-                            : (object->width.t / map->chunk_width);
-                        object->height.c = (object->height.t % map->chunk_height)
-                            ? (object->height.t / map->chunk_height) + 1
-                            : (object->height.t / map->chunk_height);
-                    } else if (TextIsEqual(node_object->key, "rotation_deg")) {
-                        object->rotation = node_object->number_;
-                    } else if (TextIsEqual(node_object->key, "position")) {
-                        json_foreach(node_offset, node_object) {
-                            if (TextIsEqual(node_offset->key, "x"))
-                                object->position.x = node_offset->number_;
-                            else if (TextIsEqual(node_offset->key, "y"))
-                                object->position.y = node_offset->number_;
-                        }
-                    } else if (TextIsEqual(node_object->key, "tiledata")) {
-                        tiledata = NULL;
-                        tile_index = 0;
-                        
-                        if (object->tileset && !object->auto_split) {
-                            tiledata = (int *) RL_CALLOC(
-                                map->width.t * map->height.t, 
-                                sizeof(int)
-                            );
-                            
-                            for (int i = 0; i < map->width.t * map->height.t; i++)
-                                tiledata[i] = -1;
-
-                            json_foreach(node_tiledata, node_object)
-                                tiledata[tile_index++] = (int) node_tiledata->number_;
-                        }
+    return length + literal_length;
+}
 
-                        if (!LoadTileData(map, object, tiledata)) {
-                            TraceLog(
-                                LOG_ERROR, 
-                                "LOWEL: [MAP '%s'] Failed to load map data: unable to load "
-                                "`tiledata` for object #%d",
-                                map->name,
-                                object_id
-                            );
+/* LZ 계열 압축 데이터의 길이 정보를 읽는다. */
+static bool ReadLZLength(const unsigned char *input, int size, int *offset, int *length) {
+    unsigned char value;
+    
+    do {
+        if (*offset >= size)
+            return false;
+        
+        value = input[(*offset)++];
+        
+        *length += value;
+    } while (value == 255);
+    
+    return true;
+}
 
-                            return false;
-                        }
-                    }
-                }
-            }
-        }
+/* 
+    `CompressLZ()`로 압축된 데이터 `input`의 압축을 풀어 `output`에 저장하고, 
+    압축을 푼 데이터의 크기를 반환한다. 압축된 데이터가 올바르지 않으면 `-1`을 반환한다.
+*/
+static int DecompressLZ(const unsigned char *input, int size, unsigned char *output, int capacity) {
+    int input_index = 0, length = 0;
+    int literal_length, match_length, match_offset;
+    
+    while (input_index < size) {
+        literal_length = input[input_index] >> 4;
+        match_length = input[input_index++] & 0x0F;
+        
+        if (literal_length == 15 && !ReadLZLength(input, size, &input_index, &literal_length))
+            return -1;
+        
+        if (literal_length > (size - input_index) || literal_length > (capacity - length))
+            return -1;
+        
+        memcpy(output + length, input + input_index, literal_length);
+        
+        input_index += literal_length;
+        length += literal_length;
+        
+        if (input_index == size)
+            break;
+        
+        if (input_index + 2 > size)
+            return -1;
+        
+        match_offset = input[input_index] | (input[input_index + 1] << 8);
+        
+        input_index += 2;
+        
+        if (match_length == 15 && !ReadLZLength(input, size, &input_index, &match_length))
+            return -1;
+        
+        match_length += LW_LZ_MIN_MATCH;
+        
+        if (match_offset == 0 || match_offset > length || match_length > (capacity - length))
+            return -1;
+        
+        /* 복사할 부분이 서로 겹칠 수 있으므로, 한 바이트씩 복사한다. */
+        for (int i = 0; i < match_length; i++, length++)
+            output[length] = output[length - match_offset];
     }
+    
+    return length;
 }
 
-/* 게임 맵의 `layers` 노드에 포함된 데이터를 불러온다. */
-static bool LoadLayersData(LwMap *map, JsonNode **node_current) {
-    JsonNode *node_layers, *node_layer;
+/* 
+    타일 `count`개의 타일 데이터 `data`를 압축 방식 `compression`으로 압축하고, 압축된 데이터의 
+    메모리 주소를 반환한다. 압축된 데이터의 첫 번째 바이트는 압축 방식을 나타낸다.
+*/
+static unsigned char *PackTileData(const int *data, int count, LwCompression compression, int *size) {
+    unsigned char *rle_data, *packed;
     
-    int layer_id = -1;
+    int rle_size, header_size;
     
-    map->layers = (LwLayer *) RL_CALLOC(
-        MAX_LAYER_COUNT, 
-        sizeof(LwLayer)
-    );
+    rle_data = (unsigned char *) RL_MALLOC(count * 10);
+    rle_size = EncodeRLE(data, count, rle_data);
     
-    json_foreach(node_layers, *node_current) {
-        json_foreach(node_layer, node_layers) {
-            if (TextIsEqual(node_layer->key, "id")) {
-                layer_id = (int) node_layer->number_;
-                
-                map->layers[layer_id]._valid = true;
-            } else {
-                if (layer_id < 0 || layer_id > MAX_LAYER_COUNT) {
-                    TraceLog(
-                        LOG_ERROR, 
-                        "LOWEL: [MAP '%s'] Failed to load map data: invalid value "
-                        "for `layer_id` in `layers`",
-                        map->name
-                    );
-                    
-                    return false;
-                } else {
-                    if (TextIsEqual(node_layer->key, "objects")) {
-                        map->layers[layer_id].objects = (LwObject *) RL_CALLOC(
-                            MAX_OBJECT_COUNT, 
-                            sizeof(LwObject)
-                        );
-                        
-                        LoadObjectsData(map, node_layer, layer_id);
-                    }
-                }
-            }
-        }
+    if (compression == LW_COMPRESSION_LZ) {
+        packed = (unsigned char *) RL_MALLOC(6 + rle_size + (rle_size / 255) + 16);
+        
+        packed[0] = LW_COMPRESSION_LZ;
+        
+        header_size = 1 + WriteVarint(packed + 1, (unsigned int) rle_size);
+        
+        *size = header_size + CompressLZ(rle_data, rle_size, packed + header_size);
+    } else {
+        packed = (unsigned char *) RL_MALLOC(1 + rle_size);
+        
+        packed[0] = LW_COMPRESSION_RLE;
+        
+        memcpy(packed + 1, rle_data, rle_size);
+        
+        *size = 1 + rle_size;
     }
     
-    return true;
+    RL_FREE(rle_data);
+    
+    return packed;
 }
 
-/* 게임 맵의 `header` 노드에 해당하는 부분을 저장한다. */
-static bool SaveHeaderData(LwMap *map, JsonNode *node_root) {
-    JsonNode *node_header;
+/* `PackTileData()`로 압축된 데이터 `packed`의 압축을 풀어, 타일 `count`개의 타일 데이터를 `data`에 저장한다. */
+static bool UnpackTileData(const unsigned char *packed, int size, int *data, int count) {
+    unsigned char *rle_data;
     
-    node_header = json_mkobject();
+    unsigned int rle_size;
     
-    json_append_member(node_header, "name", json_mkstring(map->name));
-    json_append_member(node_header, "format_version", json_mkstring(MAP_FORMAT_VERSION));
+    int header_size;
     
-    json_append_member(node_root, "header", node_header);
+    bool result;
     
-    return true;
+    if (size < 1)
+        return false;
+    
+    if (packed[0] == LW_COMPRESSION_RLE)
+        return DecodeRLE(packed + 1, size - 1, data, count);
+    
+    if (packed[0] != LW_COMPRESSION_LZ)
+        return false;
+    
+    if ((header_size = ReadVarint(packed + 1, size - 1, &rle_size)) == 0
+        || rle_size > (unsigned int) count * 10)
+        return false;
+    
+    header_size += 1;
+    
+    rle_data = (unsigned char *) RL_MALLOC(LW_MAX(rle_size, 1));
+    
+    result = DecompressLZ(packed + header_size, size - header_size, rle_data, rle_size) == (int) rle_size
+        && DecodeRLE(rle_data, rle_size, data, count);
+    
+    RL_FREE(rle_data);
+    
+    return result;
 }
 
-/* 게임 맵의 `options` 노드에 해당하는 부분을 저장한다. */
-static bool SaveOptionsData(LwMap *map, JsonNode *node_root) {
-    JsonNode *node_options;
+/* 데이터 `input`을 Base64 문자열로 변환한 다음, 그 문자열의 메모리 주소를 반환한다. */
+static char *EncodeBase64(const unsigned char *input, int size) {
+    static const char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     
-    node_options = json_mkobject();
+    char *output;
     
-    json_append_member(node_options, "width", json_mknumber(map->width.px));
-    json_append_member(node_options, "height", json_mknumber(map->height.px));
-    json_append_member(node_options, "tile_width", json_mknumber(map->tile_width));
-    json_append_member(node_options, "tile_height", json_mknumber(map->tile_height));
-    json_append_member(node_options, "chunk_width_t", json_mknumber(map->chunk_width));
-    json_append_member(node_options, "chunk_height_t", json_mknumber(map->chunk_height));
-    json_append_member(node_options, "draw_distance_c", json_mknumber(map->draw_distance));
+    unsigned int value;
     
-    json_append_member(node_root, "options", node_options);
+    int length = 0;
     
-    return true;
+    output = (char *) RL_MALLOC((4 * ((size + 2) / 3)) + 1);
+    
+    for (int i = 0; i < size; i += 3) {
+        value = (unsigned int) input[i] << 16;
+        
+        if (i + 1 < size) value |= (unsigned int) input[i + 1] << 8;
+        if (i + 2 < size) value |= (unsigned int) input[i + 2];
+        
+        output[length++] = table[(value >> 18) & 0x3F];
+        output[length++] = table[(value >> 12) & 0x3F];
+        output[length++] = (i + 1 < size) ? table[(value >> 6) & 0x3F] : '=';
+        output[length++] = (i + 2 < size) ? table[value & 0x3F] : '=';
+    }
+    
+    output[length] = '\0';
+    
+    return output;
 }
 
-/* 게임 맵의 `layers` 노드에 해당하는 부분을 저장한다. */
-static bool SaveLayersData(LwMap *map, JsonNode *node_root) {
-    JsonNode *node_layers, *node_layer;
-    JsonNode *node_objects, *node_object;
-    JsonNode *node_position, *node_tiledata;
-    JsonNode *node_center, *node_vertices, *node_vertex;
+/* Base64 문자열 `input`을 원래의 데이터로 변환하여 `output`에 저장하고, 그 데이터의 크기를 반환한다. */
+static int DecodeBase64(const char *input, unsigned char *output) {
+    unsigned int value = 0;
     
-    node_layers = json_mkarray();
+    int bits = 0, length = 0, digit;
     
-    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
-        if (!map->layers[i]._valid)
-            continue;
+    for (; *input != '\0' && *input != '='; input++) {
+        if (*input >= 'A' && *input <= 'Z') digit = *input - 'A';
+        else if (*input >= 'a' && *input <= 'z') digit = *input - 'a' + 26;
+        else if (*input >= '0' && *input <= '9') digit = *input - '0' + 52;
+        else if (*input == '+') digit = 62;
+        else if (*input == '/') digit = 63;
+        else return -1;
         
-        node_layer = json_mkobject();
-        node_objects = json_mkarray();
+        value = (value << 6) | (unsigned int) digit;
+        bits += 6;
         
-        for (int j = 0; j < MAX_OBJECT_COUNT; j++) {
-            if (!map->layers[i].objects[j]._valid)
-                continue;
-            
-            node_object = json_mkobject();
-            
-            node_position = json_mkobject();
-            node_tiledata = json_mkarray();
-            
-            json_append_member(
-                node_position, 
-                "x", 
-                json_mknumber(map->layers[i].objects[j].position.x)
-            );
-            json_append_member(
-                node_position, 
-                "y", 
-                json_mknumber(map->layers[i].objects[j].position.y)
-            );
-            
-            if (map->layers[i].objects[j].tileset
-               && !map->layers[i].objects[j].auto_split)
-                for (int k = 0; k < map->width.t * map->height.t; k++)
-                    json_append_element(
-                        node_tiledata, 
-                        json_mknumber(map->layers[i].objects[j].chunkset.tilemap[k])
-                    );
-            
-            json_append_member(
-                node_object, 
-                "id", 
-                json_mknumber(j)
-            );
-            json_append_member(
-                node_object, 
-                "image", 
-                json_mkstring(map->layers[i].objects[j].image_path)
-            );
-            json_append_member(
-                node_object, 
-                "tileset",
-                json_mkbool(map->layers[i].objects[j].tileset)
-            );
-            json_append_member(
-                node_object, 
-                "auto_split",
-                json_mkbool(map->layers[i].objects[j].auto_split)
-            );
-            json_append_member(
-                node_object, 
-                "scale_mul",
-                json_mknumber(map->layers[i].objects[j].scale)
-            );
-            json_append_member(
-                node_object, 
-                "rotation_deg",
-                json_mknumber(map->layers[i].objects[j].rotation)
-            );
-            
-            json_append_member(
-                node_object, 
-                "position",
-                node_position
-            );
-            json_append_member(
-                node_object,
-                "tiledata",
-                node_tiledata
-            );
+        if (bits >= 8) {
+            bits -= 8;
             
-            json_append_element(node_objects, node_object);
+            output[length++] = (unsigned char) ((value >> bits) & 0xFF);
         }
-        
-        json_append_member(node_layer, "id", json_mknumber(i));
-        json_append_member(node_layer, "objects", node_objects);
-        
-        json_append_element(node_layers, node_layer);
     }
     
-    json_append_member(node_root, "layers", node_layers);
-    
-    return true;
+    return length;
 }
 
-/* ::: 게임 맵 관련 함수 ::: */
-
-/* 파일에서 게임 맵 데이터를 불러온다. */
-bool LoadMap(LwMap *map, const char *file_path) {
-    char *map_data;
+/* 압축된 Base64 문자열 `string`의 압축을 풀어, 타일 `count`개의 타일 데이터를 `data`에 저장한다. */
+static bool DecodeTileDataString(const char *string, int *data, int count) {
+    unsigned char *packed;
     
-    if ((map_data = (char *) LoadFileText(file_path)) == NULL)
-        return false;
+    int packed_size;
+    
+    bool result;
+    
+    packed = (unsigned char *) RL_MALLOC(((strlen(string) * 3) / 4) + 1);
+    
+    packed_size = DecodeBase64(string, packed);
+    
+    result = (packed_size > 0) && UnpackTileData(packed, packed_size, data, count);
+    
+    RL_FREE(packed);
     
-    return LoadMapFromMemory(map, map_data);
+    return result;
 }
 
-/* 메모리에서 게임 맵 데이터를 불러온다. */
-bool LoadMapFromMemory(LwMap *map, char *map_data) {
-    JsonNode *node_root, *node_current;
+/* 타일 `count`개의 타일 데이터 `data`를 압축한 다음, 압축된 데이터를 Base64 문자열로 변환하여 반환한다. */
+static char *EncodeTileDataString(const int *data, int count, LwCompression compression) {
+    unsigned char *packed;
     
-    node_root = json_decode(map_data);
-
-    if (node_root == NULL) {
-        TraceLog(
-            LOG_ERROR, 
-            "LOWEL: Failed to load map data: `json_decode()` error"
-        );
-        
-        return false;
-    }
+    char *string;
     
-    node_current = json_first_child(node_root);
+    int packed_size;
     
-    if (!LoadHeaderData(map, &node_current) 
-        || !LoadOptionsData(map, &node_current)
-        || !LoadLayersData(map, &node_current))
-        return false;
-  
-    TraceLog(
-        LOG_INFO, 
-        "LOWEL: [MAP '%s'] Loaded map data successfully",
-        map->name
-    );
+    packed = PackTileData(data, count, compression, &packed_size);
+    string = EncodeBase64(packed, packed_size);
     
-    return true;
-}
-
-/* 위치 `position`을 기준으로 게임 맵을 화면에 그린다. */
-void DrawMap(LwMap *map, Vector2 position) {
-    LwObject *object;
+    RL_FREE(packed);
     
-    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
-        if (!map->layers[i]._valid)
-            continue;
-        
-        for (int j = 0; j < MAX_OBJECT_COUNT; j++) {
-            object = &map->layers[i].objects[j];
-            
-            if (!object->_valid || !object->texture.id)
-                continue;
-            
-            if (object->tileset && !object->auto_split
-                || !object->tileset && object->auto_split) {
-                LoadChunks(map, object, position);
-            } else {
-                DrawTextureEx(
-                    object->texture,
-                    object->position,
-                    object->rotation,
-                    object->scale,
-                    WHITE
-                );
-            }
-        }
-    }
+    return string;
 }
 
-/* 게임 맵 데이터를 파일에 저장한다. */
-bool SaveMap(LwMap *map, const char *file_path) {
-    char *map_data;
+/* `value`가 2의 거듭제곱이라면 `log2(value)`를, 아니라면 `0`을 반환한다. */
+static int GetPowerOfTwoShift(int value) {
+    int shift = 0;
     
-    if (!SaveMapToMemory(map, &map_data))
-        return false;
+    if (value <= 0 || (value & (value - 1)) != 0)
+        return 0;
+    
+    while ((1 << shift) < value)
+        shift++;
     
-    return SaveFileText(file_path, map_data);
+    return shift;
 }
 
-/* 게임 맵 데이터를 메모리에 저장한다. */
-bool SaveMapToMemory(LwMap *map, char **map_data) {
-    JsonNode *node_root, *node_current;
+/* 
+    `value / divisor`를 음의 무한대 방향으로 내림한 값을 구한다. `divisor`는 양수이어야 하며, 
+    `shift`가 0보다 크다면 나눗셈 대신 비트 시프트를 사용한다.
+*/
+static inline int FloorDivide(int value, int divisor, int shift) {
+    int quotient;
     
-    node_root = json_mkobject();
+    if (shift > 0)
+        return (value >= 0) ? (value >> shift) : ~(~value >> shift);
     
-    if (!SaveHeaderData(map, node_root)
-        || !SaveOptionsData(map, node_root)
-        || !SaveLayersData(map, node_root))
-        return false;
+    quotient = value / divisor;
     
-    *map_data = json_encode(node_root);
+    if (value < 0 && (quotient * divisor) != value)
+        quotient--;
     
-    return true;
+    return quotient;
 }
 
-/* 게임 맵 데이터의 메모리를 해제한다. */
-void UnloadMap(LwMap *map) {
-    LwObject *object;
+/* 
+    `value`를 `divisor`로 나눈 나머지를 `[0, divisor)` 범위에서 구한다. `divisor`는 양수이어야 하며, 
+    `shift`가 0보다 크다면 나머지 연산 대신 비트 마스크를 사용한다.
+*/
+static inline int FloorModulo(int value, int divisor, int shift) {
+    if (shift > 0)
+        return value & (divisor - 1);
+    
+    return value - (FloorDivide(value, divisor, 0) * divisor);
+}
+
+/* 타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 속한 청크의 청크 기준 좌표를 구한다. */
+static inline LwChunkCoord TileXYToChunkCoord(LwMap *map, int tile_x, int tile_y) {
+    return (LwChunkCoord) {
+        FloorDivide(tile_x, map->chunk_width, map->_shift.chunk_width),
+        FloorDivide(tile_y, map->chunk_height, map->_shift.chunk_height)
+    };
+}
+
+/* 레이어 `layer`의 스크롤 비율이 기본값 `(1, 1)`인지 확인한다. */
+static inline bool IsDefaultParallax(LwLayer *layer) {
+    return layer->parallax.x == 1.0f && layer->parallax.y == 1.0f;
+}
+
+/* 위치 `position`을 레이어 `layer`의 스크롤 비율에 맞게 환산한, 레이어 기준 위치를 구한다. */
+static inline Vector2 GetLayerPosition(LwLayer *layer, Vector2 position) {
+    return (Vector2) { position.x * layer->parallax.x, position.y * layer->parallax.y };
+}
+
+/* 게임 맵의 `header` 노드에 포함된 데이터를 불러온다. */
+static bool LoadHeaderData(LwMap *map, JsonNode **node_current) {
+    JsonNode *node_header;
     
-    int max_chunk_count;
+    map->name = (char *) RL_CALLOC(
+        MAX_STRING_LENGTH, 
+        sizeof(char)
+    );
     
-    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
-        if (!map->layers[i]._valid)
-            continue;
+    json_foreach(node_header, *node_current) {
+        LwKey key = GetKeyType(node_header->key);
         
-        for (int j = 0; j < MAX_OBJECT_COUNT; j++) {
-            if (!map->layers[i].objects[j]._valid)
-                continue;
-                
-            object = &map->layers[i].objects[j];
-            
-            RL_FREE(object->image_path);
+        if (key == LW_KEY_NAME) {
+            if (node_header->string_ == NULL || TextLength(node_header->string_) == 0) {
+                TraceLog(
+                    LOG_ERROR, 
+                    "LOWEL: Failed to load map data: invalid value for `name` in `header`"
+                );
+
+                return false;
+            }
             
-            if ((object->tileset && !object->auto_split)
-                || (!object->tileset && object->auto_split)) {
-                RL_FREE(object->chunkset.tilemap);
-                RL_FREE(object->chunkset.indexes);
-                
-                max_chunk_count = (object->tileset && !object->auto_split)
-                    ? (map->width.c * map->height.c)
-                    : (object->width.c * object->height.c);
+            TextCopy(map->name, node_header->string_);
+        } else if (key == LW_KEY_FORMAT_VERSION) {
+            if (node_header->string_ == NULL || TextLength(node_header->string_) == 0) {
+                TraceLog(
+                    LOG_ERROR, 
+                    "LOWEL: Failed to load map data: invalid value for `format_version` in `header`"
+                );
 
-                for (int k = 0; k < max_chunk_count; k++) {
-                    if (!object->chunkset.chunks[k]._valid)
-                        continue;
+                return false;
+            } else if (!TextIsEqual(node_header->string_, MAP_FORMAT_VERSION)) {
+                TraceLog(
+                    LOG_ERROR, 
+                    "LOWEL: Failed to load map data: map format version mismatch"
+                );
 
-                    RL_FREE(object->chunkset.chunks[k].data);
-                }
-                
-                RL_FREE(object->chunkset.chunks);
+                return false;
             }
-            
-            TraceLog(
-                LOG_INFO, 
-                "LOWEL: [MAP '%s'] Unloaded object #%d",
-                map->name,
-                j
-            );
         }
+    }
+    
+    *node_current = (*node_current)->next;
+    
+    return true;
+}
+
+/* 게임 맵의 `options` 노드에 포함된 데이터를 불러온다. */
+static bool LoadOptionsData(LwMap *map, JsonNode **node_current) {
+    JsonNode *node_options;
+    
+    json_foreach(node_options, *node_current) {
+        switch (GetKeyType(node_options->key)) {
+            case LW_KEY_WIDTH:
+                map->width.px = (int) node_options->number_;
+                break;
+                
+            case LW_KEY_HEIGHT:
+                map->height.px = (int) node_options->number_; 
+                break;
+                
+            case LW_KEY_TILE_WIDTH:
+                map->tile_width = (int) node_options->number_;
+                break;
+                
+            case LW_KEY_TILE_HEIGHT:
+                map->tile_height = (int) node_options->number_;
+                break;
+                
+            case LW_KEY_CHUNK_WIDTH_T:
+                map->chunk_width = (int) node_options->number_; 
+                break;
+                
+            case LW_KEY_CHUNK_HEIGHT_T:
+                map->chunk_height = (int) node_options->number_;
+                break;
+                
+            case LW_KEY_DRAW_DISTANCE_C:
+                map->draw_distance = (int) node_options->number_;
+                break;
+                
+            default:
+                break;
+        }
+    }
+    
+    if (map->width.px <= 0 || map->height.px <= 0
+       || map->tile_width <= 0 || map->tile_height <= 0
+       || map->chunk_width <= 0 || map->chunk_height <= 0) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to load map data: "
+            "the value of width/height property must not be negative",
+            map->name
+        );
         
-        RL_FREE(map->layers[i].objects);
+        return false;
+    }
+    
+    if (map->draw_distance < 0) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to load map data: "
+            "the value of `draw_distance` must not be negative",
+            map->name
+        );
         
+        return false;
+    } else if (map->draw_distance > MAX_DRAW_DISTANCE) {
         TraceLog(
-            LOG_INFO, 
-            "LOWEL: [MAP '%s'] Unloaded layer #%d",
+            LOG_WARNING, 
+            "LOWEL: [MAP '%s'] The value of `draw_distance` must be less than or equal to %d",
             map->name,
-            i
+            MAX_DRAW_DISTANCE
+        );
+        TraceLog(
+            LOG_WARNING, 
+            "LOWEL: [MAP '%s'] Setting the value of `draw_distance` to %d automatically",
+            map->name,
+            MAX_DRAW_DISTANCE
         );
+        
+        map->draw_distance = 16;
     }
-    RL_FREE(map->object_table);
-    RL_FREE(map->layers);
-    RL_FREE(map->name);
     
-    TraceLog(
-        LOG_INFO, 
-        "LOWEL: Unloaded map data successfully"
-    );
-}
-
-/* ::: 개체 관련 함수 ::: */
-
-/* 고유 번호가 `index`인 개체의 메모리 주소를 반환한다. */
-LwObject *GetObject(LwMap *map, int index) {
-    int layer_id;
+    map->width.t = map->width.px / map->tile_width; 
+    map->height.t = map->height.px / map->tile_height;
     
-    layer_id = map->object_table[index];
+    map->_shift = (LwMapShift) {
+        .tile_width = GetPowerOfTwoShift(map->tile_width),
+        .tile_height = GetPowerOfTwoShift(map->tile_height),
+        .chunk_width = GetPowerOfTwoShift(map->chunk_width),
+        .chunk_height = GetPowerOfTwoShift(map->chunk_height)
+    };
     
-    if (!map->layers[layer_id].objects[index]._valid)
-        return NULL;
+    map->width.c = (map->width.t % map->chunk_width) 
+        ? (map->width.t / map->chunk_width) + 1
+        : (map->width.t / map->chunk_width);
+    map->height.c = (map->height.t % map->chunk_height)
+        ? (map->height.t / map->chunk_height) + 1
+        : (map->height.t / map->chunk_height);
     
-    return &map->layers[layer_id].objects[index];
-}
-
-/* 개체의 현재 위치를 반환한다. */
-Vector2 GetObjectPosition(LwObject *object) {
-    return object->position;
+    map->_width_shift.t = GetPowerOfTwoShift(map->width.t);
+    map->_width_shift.c = GetPowerOfTwoShift(map->width.c);
+    
+    *node_current = (*node_current)->next;
+    
+    return true;
 }
 
-/* 개체 텍스처의 가로 길이를 반환한다. */
-double GetObjectWidth(LwObject *object) {
-    if (!object->_valid || !object->texture.id)
-        return 0;
+/* 개체의 청크 배열을 `chunk_count`개만큼 만들고, 모든 칸을 빈 칸으로 초기화한다. */
+static void InitChunkSet(LwMap *map, LwObject *object, int chunk_count) {
+    object->chunkset.count = chunk_count;
+    
+    object->chunkset.indexes = (int *) RL_CALLOC(
+        GetAdjacentChunkCount(map),
+        sizeof(int)
+    );
+    
+    object->chunkset.temp_index = -1;
     
-    return object->texture.width * object->scale; 
+    object->chunkset.chunks = (LwChunk *) RL_CALLOC(
+        chunk_count,
+        sizeof(LwChunk)
+    );
+    
+    for (int i = 0; i < chunk_count; i++) {
+        object->chunkset.chunks[i].data = (int *) RL_MALLOC(
+            map->chunk_width * map->chunk_height * sizeof(int)
+        );
+        
+        for (int j = 0; j < (map->chunk_width * map->chunk_height); j++)
+            object->chunkset.chunks[i].data[j] = -1;
+        
+        object->chunkset.chunks[i].revision = ++map->_revision;
+    }
+    
+    object->chunkset.dirty_indexes = (int *) RL_CALLOC(
+        chunk_count,
+        sizeof(int)
+    );
+    
+    object->chunkset.dirty_count = 0;
+    
+    object->chunkset.animated_indexes = (int *) RL_CALLOC(
+        chunk_count,
+        sizeof(int)
+    );
+    
+    object->chunkset.animated_count = 0;
 }
 
-/* 개체 텍스처의 세로 길이를 반환한다. */
-double GetObjectHeight(LwObject *object) {
-    if (!object->_valid || !object->texture.id)
-        return 0;
+/* 
+    타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 속한 청크의 인덱스와, 그 청크 안에서의 
+    상대적인 타일 인덱스를 구한다.
+*/
+static int TileXYToChunkIndex(
+    LwMap *map, int width_c, 
+    int tile_x, int tile_y, 
+    int *relative_tile_index
+) {
+    LwChunkCoord chunk = TileXYToChunkCoord(map, tile_x, tile_y);
+    
+    *relative_tile_index = (FloorModulo(tile_y, map->chunk_height, map->_shift.chunk_height) 
+        * map->chunk_width) + FloorModulo(tile_x, map->chunk_width, map->_shift.chunk_width);
     
-    return object->texture.height * object->scale;
+    return (chunk.y * width_c) + chunk.x;
 }
 
-/* 개체의 현재 위치를 `position`으로 변경한다. */
-void SetObjectPosition(LwObject *object, Vector2 position) {
-    object->position = position;
+/* 
+    고유 번호가 `index`인 청크에 `flags`에 해당하는 변경 사항을 표시한다. 
+    다시 그려야 하는 청크라면, 청크의 번호도 새로 매긴다.
+*/
+static void MarkChunkDirty(LwMap *map, LwObject *object, int index, int flags) {
+    LwChunk *chunk = &object->chunkset.chunks[index];
+    
+    if (!chunk->dirty)
+        object->chunkset.dirty_indexes[object->chunkset.dirty_count++] = index;
+    
+    chunk->dirty |= flags;
+    
+    if (flags & LW_DIRTY_RENDER)
+        chunk->revision = ++map->_revision;
 }
 
-/* ::: 청크 관련 함수 ::: */
-
-/* 게임 맵 또는 개체 텍스처에서 고유 번호가 `index`인 청크를 게임 화면에 그린다. */
-void DrawChunk(LwMap *map, LwObject *object, int index) {
-    Vector2 tile_position, orig_texture_position;
+/* 
+    고유 번호가 `index`인 청크의 타일 데이터를 반환한다. 
+    청크가 압축되어 있다면, 압축을 풀어서 메모리에 다시 올려놓는다.
+*/
+static int *GetChunkData(LwMap *map, LwObject *object, int index) {
+    LwChunk *chunk = &object->chunkset.chunks[index];
     
-    int tile_id;
+    if (chunk->data != NULL)
+        return chunk->data;
     
-    for (int i = 0; i < (map->chunk_width * map->chunk_height); i++) {
-        tile_id = object->chunkset.chunks[index].data[i];
-        
-        tile_position = (object->tileset && !object->auto_split)
-            ? RelativeTileIndexToPositionMap(map, index, i)
-            : RelativeTileIndexToPositionObject(map, object, index, i);
-        
-        orig_texture_position = TileIndexToPositionObject(map, object, tile_id);
-        
-        DrawTextureRec(
-            object->texture,
-            (Rectangle) {
-                orig_texture_position.x - object->position.x,
-                orig_texture_position.y - object->position.y,
-                map->tile_width,
-                map->tile_height
-            },
-            tile_position,
-            WHITE
+    chunk->data = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+    
+    if (!UnpackTileData(chunk->packed, chunk->packed_size, chunk->data, map->chunk_width * map->chunk_height)) {
+        TraceLog(
+            LOG_WARNING, 
+            "LOWEL: [MAP '%s'] Failed to unpack chunk #%d of object #%d",
+            map->name,
+            index,
+            object->id
         );
+        
+        for (int i = 0; i < (map->chunk_width * map->chunk_height); i++)
+            chunk->data[i] = -1;
     }
+    
+    RL_FREE(chunk->packed);
+    
+    chunk->packed = NULL;
+    chunk->packed_size = 0;
+    
+    return chunk->data;
 }
 
-/* 위치 `position`의 주변에 있는 청크를 모두 로드한다. */
-void LoadChunks(LwMap *map, LwObject *object, Vector2 position) {
-    int chunk_index;
+/* 
+    고유 번호가 `index`인 청크의 타일 데이터를 반환한다. 
+    청크가 압축되어 있다면, 청크는 그대로 둔 채로 `buffer`에 압축을 풀어서 반환한다.
+*/
+static const int *PeekChunkData(LwMap *map, LwObject *object, int index, int *buffer) {
+    LwChunk *chunk = &object->chunkset.chunks[index];
     
-    chunk_index = (object->tileset && !object->auto_split)
-        ? PositionToChunkIndexMap(map, position)
-        : PositionToChunkIndexObject(map, object, position);
-        
-    if (chunk_index >= 0) {
-        UpdateAdjacentChunkIndexes(map, object, chunk_index);
-
-        for (int adjacent_index = 0; adjacent_index < GetAdjacentChunkCount(map); adjacent_index++) {
-            DrawChunk(map, object, object->chunkset.indexes[adjacent_index]);
-
-            object->chunkset.indexes[adjacent_index] = chunk_index;
-        }
-    }
+    if (chunk->data != NULL)
+        return chunk->data;
+    
+    if (!UnpackTileData(chunk->packed, chunk->packed_size, buffer, map->chunk_width * map->chunk_height))
+        for (int i = 0; i < (map->chunk_width * map->chunk_height); i++)
+            buffer[i] = -1;
+    
+    return buffer;
 }
 
-/* 거리가 `map.draw_distance` 이하인 청크의 최대 개수를 구한다. */
-int GetAdjacentChunkCount(LwMap *map) {
-    return (2 * map->draw_distance + 1) * (2 * map->draw_distance + 1);
+/* 
+    컨텍스트 `context`를 사용하여 고유 번호가 `index`인 청크의 타일 데이터를 반환한다.
+    청크가 압축되어 있다면, 청크는 그대로 둔 채로 컨텍스트의 버퍼에 압축을 풀고 다음 호출에서 다시 사용한다.
+*/
+static const int *PeekQueryChunkData(LwQueryContext *context, LwObject *object, int index) {
+    LwChunk *chunk = &object->chunkset.chunks[index];
+    
+    if (chunk->data != NULL)
+        return chunk->data;
+    
+    if (context->buffer_object != object || context->buffer_index != index
+        || context->buffer_packed != chunk->packed || context->buffer_revision != chunk->revision) {
+        PeekChunkData(context->map, object, index, context->buffer);
+        
+        context->buffer_object = object;
+        context->buffer_index = index;
+        context->buffer_packed = chunk->packed;
+        context->buffer_revision = chunk->revision;
+    }
+    
+    return context->buffer;
 }
 
 /* 
-    고유 번호가 `index`인 청크에서 거리가 `map.draw_distance` 이하인 모든 청크의 고유 번호를 
-    구한 다음, `object.chunk_indexes`에 저장한다.
+    PNG 파일 `file_path`의 헤더만 읽어서, 이미지를 디코딩하지 않고 가로 및 세로 길이를 알아낸다.
+    PNG 파일이 아니거나 헤더를 읽을 수 없으면 `false`를 반환한다.
 */
-void UpdateAdjacentChunkIndexes(LwMap *map, LwObject *object, int index) {
-    int adjacent_index;
-    int adjacent_chunk_x, adjacent_chunk_y;
+static bool ReadImageSize(const char *file_path, int *width, int *height) {
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
     
-    adjacent_index = 0;
+    unsigned char header[24];
     
-    if (object->chunkset.temp_index == index)
-        return;
+    unsigned int values[2];
+    
+    FILE *file = fopen(file_path, "rb");
+    
+    if (file == NULL)
+        return false;
+    
+    if (fread(header, 1, sizeof(header), file) != sizeof(header)) {
+        fclose(file);
         
-    object->chunkset.temp_index = index;
+        return false;
+    }
     
-    for (int dy = (map->draw_distance); dy >= -(map->draw_distance); dy--) {
-        for (int dx = (map->draw_distance); dx >= -(map->draw_distance); dx--) {
-            if (object->tileset && !object->auto_split) {
-                adjacent_chunk_x = GetMapChunkX(map, index) - dx;
-                adjacent_chunk_y = GetMapChunkY(map, index) - dy;
-
-                if (adjacent_chunk_x < 0 || adjacent_chunk_x > map->width.c - 1
-                   || adjacent_chunk_y < 0 || adjacent_chunk_y > map->height.c - 1)
-                    continue;
+    fclose(file);
+    
+    /* PNG 파일은 시그니처 바로 다음에 `IHDR` 청크가 오고, 그 안에 가로 및 세로 길이가 빅 엔디언으로 저장된다. */
+    if (memcmp(header, signature, sizeof(signature)) != 0 || memcmp(header + 12, "IHDR", 4) != 0)
+        return false;
+    
+    for (int i = 0; i < 2; i++)
+        values[i] = ((unsigned int) header[16 + 4 * i] << 24) 
+            | ((unsigned int) header[17 + 4 * i] << 16)
+            | ((unsigned int) header[18 + 4 * i] << 8) 
+            | (unsigned int) header[19 + 4 * i];
+    
+    if (values[0] == 0 || values[1] == 0 || values[0] > INT_MAX || values[1] > INT_MAX)
+        return false;
+    
+    *width = (int) values[0], *height = (int) values[1];
+    
+    return true;
+}
 
-                object->chunkset.indexes[adjacent_index++] = (adjacent_chunk_y * map->width.c)
-                    + adjacent_chunk_x;
-            } else {
-                adjacent_chunk_x = GetObjectChunkX(object, index) - dx;
-                adjacent_chunk_y = GetObjectChunkY(object, index) - dy;
+/* 
+    개체의 이미지 크기와 `object.scale`을 기준으로 개체의 가로 및 세로 길이를 다시 계산한다.
+    텍스처를 불러왔다면 텍스처의 크기를 이미지 크기로 사용한다.
+*/
+static void UpdateObjectSize(LwMap *map, LwObject *object) {
+    if (object->texture.id) {
+        object->image_width = object->texture.width;
+        object->image_height = object->texture.height;
+    }
+    
+    object->width.px = object->image_width * object->scale;
+    object->height.px = object->image_height * object->scale;
 
-                if (adjacent_chunk_x < 0 || adjacent_chunk_x > object->width.c - 1
-                   || adjacent_chunk_y < 0 || adjacent_chunk_y > object->height.c - 1)
-                    continue;
+    object->width.t = object->width.px / map->tile_width;
+    object->height.t = object->height.px / map->tile_height;
 
-                object->chunkset.indexes[adjacent_index++] = (adjacent_chunk_y * object->width.c)
-                    + adjacent_chunk_x;
-            }
-        }
-    }
+    object->width.c = (object->width.t % map->chunk_width) 
+        ? (object->width.t / map->chunk_width) + 1
+        : (object->width.t / map->chunk_width);
+    object->height.c = (object->height.t % map->chunk_height)
+        ? (object->height.t / map->chunk_height) + 1
+        : (object->height.t / map->chunk_height);
+    
+    object->width_shift.t = GetPowerOfTwoShift(object->width.t);
+    object->width_shift.c = GetPowerOfTwoShift(object->width.c);
 }
 
-/* 게임 맵에서 고유 번호가 `index`인 청크의 청크 기준 X좌표를 반환한다. */
-int GetMapChunkX(LwMap *map, int index) {
-    return (index % map->width.c);
+/* 워드 `value`에서 1인 비트의 개수를 구한다. */
+static inline int CountBits(uint32_t value) {
+    value = value - ((value >> 1) & 0x55555555u);
+    value = (value & 0x33333333u) + ((value >> 2) & 0x33333333u);
+    
+    return (int) ((((value + (value >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
 }
 
-/* 게임 맵에서 고유 번호가 `index`인 청크의 청크 기준 Y좌표를 반환한다. */
-int GetMapChunkY(LwMap *map, int index) {
-    return (index / map->width.c);
+/* 
+    비트 배열 `words`에서 `start`번째 비트부터 `count`개의 비트를 1로 만들고, 새로 1이 된 비트의 
+    개수를 반환한다. 비트를 하나씩 바꾸지 않고 워드 단위로 바꾼다.
+*/
+static int SetBitRange(uint32_t *words, int start, int count) {
+    uint32_t mask;
+    
+    int end = start + count, length, added = 0;
+    
+    while (start < end) {
+        length = LW_MIN(32 - (start & 31), end - start);
+        
+        mask = (length == 32) ? ~0u : (((1u << length) - 1) << (start & 31));
+        
+        added += CountBits(mask & ~words[start >> 5]);
+        
+        words[start >> 5] |= mask;
+        
+        start += length;
+    }
+    
+    return added;
 }
 
-/* 게임 맵에서 고유 번호가 `index`인 타일의 타일 기준 X좌표를 반환한다. */
-int GetMapTileX(LwMap *map, int index) {
-    return (index % map->width.t);
+/* 비트 배열 `words`에서 `index`번째 비트가 1인지 확인한다. */
+static inline bool IsBitSet(const uint32_t *words, int index) {
+    return (words[index >> 5] & (1u << (index & 31))) != 0;
 }
 
-/* 게임 맵에서 고유 번호가 `index`인 타일의 타일 기준 Y좌표를 반환한다. */
-int GetMapTileY(LwMap *map, int index) {
-    return (index / map->width.t);
+/* 게임 맵의 전장의 안개를 만든다. 처음에는 모든 타일이 가려져 있다. */
+static bool InitFog(LwMap *map) {
+    int chunk_count = map->width.c * map->height.c;
+    
+    if (map->_fog != NULL)
+        return true;
+    
+    if (chunk_count <= 0)
+        return false;
+    
+    map->_fog = (LwFog *) RL_CALLOC(1, sizeof(LwFog));
+    
+    map->_fog->chunk_words = ((map->chunk_width * map->chunk_height) + 31) >> 5;
+    
+    map->_fog->explored = (uint32_t *) RL_CALLOC(chunk_count * map->_fog->chunk_words, sizeof(uint32_t));
+    map->_fog->visible = (uint32_t *) RL_CALLOC(chunk_count * map->_fog->chunk_words, sizeof(uint32_t));
+    
+    map->_fog->explored_counts = (int *) RL_CALLOC(chunk_count, sizeof(int));
+    map->_fog->visible_indexes = (int *) RL_CALLOC(chunk_count, sizeof(int));
+    map->_fog->visible_listed = (bool *) RL_CALLOC(chunk_count, sizeof(bool));
+    
+    return true;
 }
 
-/* 개체 텍스처에서 고유 번호가 `index`인 청크의 청크 기준 X좌표를 반환한다. */
-int GetObjectChunkX(LwObject *object, int index) {
-    return (index % object->width.c);
+/* 
+    타일 기준 세로 좌표가 `tile_y`인 행에서 `min_x`부터 `max_x`까지의 타일을 지금 보이는 타일과 
+    본 적이 있는 타일로 표시한다. 행을 청크 단위로 나누어 워드 단위로 표시한다.
+*/
+static void RevealFogSpan(LwMap *map, int tile_y, int min_x, int max_x) {
+    LwFog *fog = map->_fog;
+    
+    int chunk_index, chunk_x, chunk_y, relative_y, span_end, start;
+    
+    if (tile_y < 0 || tile_y > map->height.t - 1)
+        return;
+    
+    min_x = LW_MAX(min_x, 0);
+    max_x = LW_MIN(max_x, map->width.t - 1);
+    
+    chunk_y = FloorDivide(tile_y, map->chunk_height, map->_shift.chunk_height);
+    relative_y = FloorModulo(tile_y, map->chunk_height, map->_shift.chunk_height);
+    
+    for (int tile_x = min_x; tile_x <= max_x; tile_x = span_end + 1) {
+        chunk_x = FloorDivide(tile_x, map->chunk_width, map->_shift.chunk_width);
+        
+        span_end = LW_MIN(max_x, ((chunk_x + 1) * map->chunk_width) - 1);
+        
+        chunk_index = (chunk_y * map->width.c) + chunk_x;
+        
+        start = (relative_y * map->chunk_width) 
+            + FloorModulo(tile_x, map->chunk_width, map->_shift.chunk_width);
+        
+        fog->explored_counts[chunk_index] += SetBitRange(
+            &fog->explored[chunk_index * fog->chunk_words], 
+            start, 
+            span_end - tile_x + 1
+        );
+        
+        SetBitRange(&fog->visible[chunk_index * fog->chunk_words], start, span_end - tile_x + 1);
+        
+        if (!fog->visible_listed[chunk_index]) {
+            fog->visible_listed[chunk_index] = true;
+            fog->visible_indexes[fog->visible_count++] = chunk_index;
+        }
+    }
 }
 
-/* 개체 텍스처에서 고유 번호가 `index`인 청크의 청크 기준 Y좌표를 반환한다. */
-int GetObjectChunkY(LwObject *object, int index) {
-    return (index / object->width.c);
+/* 
+    타일 기준 좌표가 `center`인 타일에서 팔분면 하나를 따라 시야를 넓혀가며, 충돌 판정이 있는 타일에 
+    가려지지 않은 타일을 표시한다. (재귀적 그림자 투사 방식) `(xx, xy, yx, yy)`는 팔분면의 좌표를 
+    게임 맵의 좌표로 바꾸는 행렬이다.
+*/
+static void CastFogShadow(
+    LwMap *map, LwTileCoord center, int radius, int row, 
+    float start_slope, float end_slope, 
+    int xx, int xy, int yx, int yy
+) {
+    float left_slope, right_slope, next_start_slope = start_slope;
+    
+    int tile_x, tile_y, delta_y;
+    
+    bool blocked = false, opaque;
+    
+    if (start_slope < end_slope)
+        return;
+    
+    for (int distance = row; distance <= radius && !blocked; distance++) {
+        delta_y = -distance;
+        
+        for (int delta_x = -distance; delta_x <= 0; delta_x++) {
+            left_slope = (delta_x - 0.5f) / (delta_y + 0.5f);
+            right_slope = (delta_x + 0.5f) / (delta_y - 0.5f);
+            
+            if (start_slope < right_slope)
+                continue;
+            
+            if (end_slope > left_slope)
+                break;
+            
+            tile_x = center.x + (delta_x * xx) + (delta_y * xy);
+            tile_y = center.y + (delta_x * yx) + (delta_y * yy);
+            
+            opaque = tile_x < 0 || tile_x > map->width.t - 1 
+                || tile_y < 0 || tile_y > map->height.t - 1
+                || IsTileSolid(map, tile_x, tile_y);
+            
+            /* 시야를 가리는 타일도 보이는 타일이다. */
+            if ((delta_x * delta_x) + (delta_y * delta_y) <= radius * radius)
+                RevealFogSpan(map, tile_y, tile_x, tile_x);
+            
+            if (blocked) {
+                if (opaque) {
+                    next_start_slope = right_slope;
+                    
+                    continue;
+                }
+                
+                blocked = false;
+                start_slope = next_start_slope;
+            } else if (opaque && distance < radius) {
+                blocked = true;
+                
+                CastFogShadow(
+                    map, center, radius, distance + 1, 
+                    start_slope, left_slope, 
+                    xx, xy, yx, yy
+                );
+                
+                next_start_slope = right_slope;
+            }
+        }
+    }
 }
 
-/* 개체 텍스처에서 고유 번호가 `index`인 타일의 타일 기준 X좌표를 반환한다. */
-int GetObjectTileX(LwObject *object, int index) {
-    return (index % object->width.t);
+/* 
+    전장의 안개가 있다면, 고유 번호가 `index`인 청크에서 본 적이 있는 타일의 개수를 반환한다. 
+    전장의 안개가 없다면 청크의 모든 타일을 본 것으로 간주한다.
+*/
+static inline int GetExploredTileCount(LwMap *map, int index) {
+    return (map->_fog != NULL) 
+        ? map->_fog->explored_counts[index] 
+        : map->chunk_width * map->chunk_height;
 }
 
-/* 개체 텍스처에서 고유 번호가 `index`인 타일의 타일 기준 Y좌표를 반환한다. */
-int GetObjectTileY(LwObject *object, int index) {
-    return (index / object->width.t);
+/* 청크마다 나누어진 비트 배열 `words`에서 타일 기준 좌표가 `(x, y)`인 타일의 비트를 확인한다. */
+static bool IsFogTileSet(LwMap *map, const uint32_t *words, int x, int y) {
+    int chunk_index, relative_index;
+    
+    chunk_index = (FloorDivide(y, map->chunk_height, map->_shift.chunk_height) * map->width.c)
+        + FloorDivide(x, map->chunk_width, map->_shift.chunk_width);
+    
+    relative_index = (FloorModulo(y, map->chunk_height, map->_shift.chunk_height) * map->chunk_width)
+        + FloorModulo(x, map->chunk_width, map->_shift.chunk_width);
+    
+    return IsBitSet(&words[chunk_index * map->_fog->chunk_words], relative_index);
 }
 
-/* 게임 맵에서 고유 번호가 `index`인 청크의 시작 위치를 구한다. */
-Vector2 ChunkIndexToPositionMap(LwMap *map, int index) {
-    return (Vector2) { 
-        GetMapChunkX(map, index) * (map->chunk_width * map->tile_width),
-        GetMapChunkY(map, index) * (map->chunk_height * map->tile_height)
-    };
+/* 개체 `object`에서 고유 번호가 `tile_id`인 타일에 애니메이션이 있는지 확인한다. */
+static inline bool IsAnimatedTileId(LwObject *object, int tile_id) {
+    return tile_id >= 0 && tile_id < object->animation_lookup_size 
+        && object->animation_lookup[tile_id] >= 0;
 }
 
-/* 개체 텍스처에서 고유 번호가 `index`인 청크의 시작 위치를 구한다. */
-Vector2 ChunkIndexToPositionObject(LwMap *map, LwObject *object, int index) {
-    return (Vector2) { 
-        object->position.x + (GetObjectChunkX(object, index) * (map->chunk_width * map->tile_width)),
-        object->position.y + (GetObjectChunkY(object, index) * (map->chunk_height * map->tile_height))
+/* 타일셋 개체 `object`의 텍스처에서 고유 번호가 `tile_id`인 타일의 영역을 반환한다. */
+static inline Rectangle GetTileSourceRec(LwMap *map, LwObject *object, int tile_id) {
+    return (Rectangle) {
+        GetObjectTileX(object, tile_id) * map->tile_width,
+        GetObjectTileY(object, tile_id) * map->tile_height,
+        map->tile_width,
+        map->tile_height
     };
 }
 
-/* 게임 맵에서 위치 `position`이 속한 청크의 인덱스를 구한다. */
-int PositionToChunkIndexMap(LwMap *map, Vector2 position) {
-    int tile_index;
+/* 
+    타일 데이터가 `chunk_data`인, 고유 번호가 `index`인 청크에서 애니메이션이 있는 타일의 목록을 
+    다시 만든다.
+*/
+static void UpdateAnimatedTiles(LwMap *map, LwObject *object, int index, const int *chunk_data) {
+    LwChunk *chunk = &object->chunkset.chunks[index];
     
-    if ((tile_index = PositionToTileIndexMap(map, position)) < 0)
-        return -1;
+    int count = 0;
     
-    return TileIndexToChunkIndexMap(map, tile_index);
-}
-
-/* 개체 텍스처에서 위치 `position`이 속한 청크의 인덱스를 구한다. */
-int PositionToChunkIndexObject(LwMap *map, LwObject *object, Vector2 position) {
-    int tile_index;
+    for (int i = 0; i < (map->chunk_width * map->chunk_height); i++)
+        if (IsAnimatedTileId(object, chunk_data[i]))
+            count++;
     
-    if ((tile_index = PositionToTileIndexObject(map, object, position)) < 0)
-        return -1;
+    RL_FREE(chunk->animated_tiles);
     
-    return TileIndexToChunkIndexObject(map, object, tile_index);
-}
-
-/* 게임 맵에서 위치 `position`이 속한 타일의 인덱스를 구한다. */
-int PositionToTileIndexMap(LwMap *map, Vector2 position) {
-    int tile_x, tile_y;
+    chunk->animated_tiles = NULL;
+    chunk->animated_tile_count = 0;
     
-    tile_x = ((int) position.x / map->tile_width) % map->width.t;
-    tile_y = ((int) position.y / map->tile_height) % map->height.t;
+    if (count == 0)
+        return;
+    
+    chunk->animated_tiles = (int *) RL_MALLOC(count * sizeof(int));
     
-    if (tile_x <= 0) tile_x = 0;
-    if (tile_y <= 0) tile_y = 0;
+    for (int i = 0; i < (map->chunk_width * map->chunk_height); i++)
+        if (IsAnimatedTileId(object, chunk_data[i]))
+            chunk->animated_tiles[chunk->animated_tile_count++] = i;
     
-    return (tile_y * map->width.t) + tile_x;
+    if (!chunk->_animated_listed) {
+        object->chunkset.animated_indexes[object->chunkset.animated_count++] = index;
+        
+        chunk->_animated_listed = true;
+    }
 }
 
-/* 개체 텍스처에서 위치 `position`이 속한 타일의 인덱스를 구한다. */
-int PositionToTileIndexObject(LwMap *map, LwObject *object, Vector2 position) {
-    int tile_x, tile_y;
+/* 
+    타일셋 개체 `object`의 모든 청크에서 애니메이션이 있는 타일의 목록을 만든다. 
+    애니메이션을 진행시킬 때는 이 목록에 있는 타일만 확인한다.
+*/
+static void BuildAnimatedTiles(LwMap *map, LwObject *object) {
+    int *chunk_buffer;
     
-    tile_x = ((int) (position.x - object->position.x) / map->tile_width) % object->width.t;
-    tile_y = ((int) (position.y - object->position.y) / map->tile_height) % object->height.t;
+    if (object->animation_count <= 0 || object->chunkset.chunks == NULL
+        || !object->tileset || object->auto_split)
+        return;
+    
+    chunk_buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
     
-    if (tile_x <= 0) tile_x = 0;
-    if (tile_y <= 0) tile_y = 0;
+    for (int i = 0; i < object->chunkset.count; i++)
+        if (object->chunkset.chunks[i]._valid)
+            UpdateAnimatedTiles(map, object, i, PeekChunkData(map, object, i, chunk_buffer));
     
-    return (tile_y * object->width.t) + tile_x;
+    RL_FREE(chunk_buffer);
 }
 
-/* 게임 맵에서 고유 번호가 `chunk_index`인 청크의 `relative_tile_index + 1`번째 타일의 시작 위치를 구한다. */
-Vector2 RelativeTileIndexToPositionMap(
-    LwMap *map, 
-    int chunk_index, int relative_tile_index
-) {
-    Vector2 chunk_position = ChunkIndexToPositionMap(map, chunk_index);
-    
-    return (Vector2) {
-        chunk_position.x + ((relative_tile_index % map->chunk_width) * map->tile_width),
-        chunk_position.y + ((relative_tile_index / map->chunk_width) * map->tile_height)
-    };
+/* 개체 `object`에서 고유 번호가 `tile_id`인 타일이 충돌 판정이 있는 타일인지 확인한다. */
+static inline bool IsSolidTileId(LwObject *object, int tile_id) {
+    return tile_id >= 0 && tile_id < object->solid_tile_count
+        && (object->solid_tiles[tile_id >> 5] & (1u << (tile_id & 31))) != 0;
 }
 
-/* 개체 텍스처에서 고유 번호가 `chunk_index`인 청크의 `relative_tile_index + 1`번째 타일의 시작 위치를 구한다. */
-Vector2 RelativeTileIndexToPositionObject(
-    LwMap *map, LwObject *object, 
-    int chunk_index, int relative_tile_index
-) {
-    Vector2 chunk_position = ChunkIndexToPositionObject(map, object, chunk_index);
-    
-    return (Vector2) {
-        chunk_position.x + ((relative_tile_index % map->chunk_width) * map->tile_width),
-        chunk_position.y + ((relative_tile_index / map->chunk_width) * map->tile_height)
-    };
+/* 개체 `object`의 타일 데이터가 게임 맵의 충돌 판정에 영향을 주는지 확인한다. */
+static bool HasSolidTiles(LwObject *object) {
+    return object->_valid && object->tileset && !object->auto_split 
+        && object->solid_tiles != NULL && object->chunkset.chunks != NULL;
 }
 
-/* 고유 번호가 `index`인 타일이 속한 청크의 인덱스를 구한다. */
-int TileIndexToChunkIndexMap(LwMap *map, int index) {
-    int chunk_x, chunk_y;
+/* 게임 맵의 충돌 판정 비트 배열에서, 한 줄에 해당하는 32비트 워드의 개수를 반환한다. */
+static inline int GetSolidRowWords(LwMap *map) {
+    return (map->width.t + 31) >> 5;
+}
+
+/* 
+    게임 맵의 `tile_y`번째 줄에서 타일 기준 X좌표가 `min_x` 이상 `max_x` 이하인 타일 중에, 
+    충돌 판정이 있는 첫 번째 타일의 X좌표를 반환한다. 그러한 타일이 없다면 `-1`을 반환한다.
+*/
+static int FindSolidTileInRow(LwMap *map, int tile_y, int min_x, int max_x) {
+    const uint32_t *row;
+    
+    uint32_t word;
+    
+    if (map->_solid == NULL || tile_y < 0 || tile_y > map->height.t - 1)
+        return -1;
+    
+    min_x = LW_MAX(min_x, 0);
+    max_x = LW_MIN(max_x, map->width.t - 1);
+    
+    row = map->_solid + (tile_y * GetSolidRowWords(map));
     
-    chunk_x = GetMapTileX(map, index) / map->chunk_width;
-    chunk_y = GetMapTileY(map, index) / map->chunk_height;
+    /* 32개의 타일을 한 번에 확인하고, 비어 있지 않은 워드에서만 비트 단위로 찾는다. */
+    for (int i = (min_x >> 5); i <= (max_x >> 5) && min_x <= max_x; i++) {
+        word = row[i];
+        
+        if (i == (min_x >> 5))
+            word &= ~0u << (min_x & 31);
+        
+        if (i == (max_x >> 5))
+            word &= ~0u >> (31 - (max_x & 31));
+        
+        if (word == 0)
+            continue;
+        
+        for (int j = 0; j < 32; j++)
+            if (word & (1u << j))
+                return (i << 5) + j;
+    }
     
-    return (chunk_y * map->width.c) + chunk_x;
+    return -1;
 }
 
-/* 고유 번호가 `index`인 타일이 속한 청크의 인덱스를 구한다. */
-int TileIndexToChunkIndexObject(LwMap *map, LwObject *object, int index) {
-    int chunk_x, chunk_y;
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 충돌 판정 여부를 다시 계산한다. */
+static void UpdateSolidTile(LwMap *map, int tile_x, int tile_y) {
+    LwObject *object;
+    
+    uint32_t *word;
+    
+    int chunk_index, relative_tile_index;
+    
+    bool solid = false;
+    
+    if (map->_solid == NULL)
+        return;
     
-    chunk_x = GetObjectTileX(object, index) / map->chunk_width;
-    chunk_y = GetObjectTileY(object, index) / map->chunk_height;
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    for (int i = 0; i < MAX_LAYER_COUNT && !solid; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0 && !solid; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (HasSolidTiles(object))
+                solid = IsSolidTileId(object, GetChunkData(map, object, chunk_index)[relative_tile_index]);
+        }
+    }
+    
+    word = &map->_solid[(tile_y * GetSolidRowWords(map)) + (tile_x >> 5)];
     
-    return (chunk_y * object->width.c) + chunk_x;
+    if (solid)
+        *word |= (1u << (tile_x & 31));
+    else
+        *word &= ~(1u << (tile_x & 31));
 }
 
-/* 고유 번호가 `index`인 타일의 시작 위치를 구한다. */
-Vector2 TileIndexToPositionMap(LwMap *map, int index) {
-    return (Vector2) {
-        GetMapTileX(map, index) * map->tile_width,
-        GetMapTileY(map, index) * map->tile_height
-    };
+/* 
+    게임 맵의 모든 타일의 충돌 판정 여부를 다시 계산하여, 타일마다 1비트씩 `map._solid`에 저장한다.
+    충돌 판정이 있는 타일을 가진 개체가 없다면, `map._solid`는 `NULL`이 된다.
+*/
+static void BuildCollisionGrid(LwMap *map) {
+    LwObject *object;
+    
+    const int *chunk_data;
+    
+    int *chunk_buffer;
+    
+    int tile_x, tile_y, tile_id;
+    
+    RL_FREE(map->_solid);
+    
+    map->_solid = NULL;
+    
+    /* 충돌 판정이 바뀌었으므로, 경로 탐색에 사용되는 출입구도 모두 다시 계산해야 한다. */
+    if (map->_path_graph != NULL)
+        for (int i = 0; i < map->_path_graph->chunk_count; i++)
+            map->_path_graph->stale[i] = true;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT && map->_solid == NULL; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            if (!HasSolidTiles(&map->layers[i].objects[j]))
+                continue;
+            
+            map->_solid = (uint32_t *) RL_CALLOC(
+                GetSolidRowWords(map) * map->height.t, 
+                sizeof(uint32_t)
+            );
+            
+            break;
+        }
+    }
+    
+    if (map->_solid == NULL)
+        return;
+    
+    chunk_buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!HasSolidTiles(object))
+                continue;
+            
+            for (int k = 0; k < object->chunkset.count; k++) {
+                if (!object->chunkset.chunks[k]._valid)
+                    continue;
+                
+                /* 압축된 청크는 압축을 풀지 않고 읽기만 한다. */
+                chunk_data = PeekChunkData(map, object, k, chunk_buffer);
+                
+                for (int l = 0; l < (map->chunk_width * map->chunk_height); l++) {
+                    if ((tile_id = chunk_data[l]) < 0 || !IsSolidTileId(object, tile_id))
+                        continue;
+                    
+                    tile_x = (GetMapChunkX(map, k) * map->chunk_width) + (l % map->chunk_width);
+                    tile_y = (GetMapChunkY(map, k) * map->chunk_height) + (l / map->chunk_width);
+                    
+                    if (tile_x > map->width.t - 1 || tile_y > map->height.t - 1)
+                        continue;
+                    
+                    map->_solid[(tile_y * GetSolidRowWords(map)) + (tile_x >> 5)] |= (1u << (tile_x & 31));
+                }
+            }
+        }
+    }
+    
+    RL_FREE(chunk_buffer);
 }
 
-/* 고유 번호가 `index`인 타일의 시작 위치를 구한다. */
-Vector2 TileIndexToPositionObject(LwMap *map, LwObject *object, int index) {
-    return (Vector2) {
-        object->position.x + (GetObjectTileX(object, index) * map->tile_width),
-        object->position.y + (GetObjectTileY(object, index) * map->tile_height)
+/* 개체 `object`에서 고유 번호가 `tile_id`인 타일이 빛을 가로막는 타일인지 확인한다. */
+static inline bool IsOpaqueTileId(LwObject *object, int tile_id) {
+    return tile_id >= 0 && tile_id < object->opaque_tile_count
+        && (object->opaque_tiles[tile_id >> 5] & (1u << (tile_id & 31))) != 0;
+}
+
+/* 개체 `object`의 타일 데이터가 게임 맵의 조명에 영향을 주는지 확인한다. */
+static bool HasOpaqueTiles(LwObject *object) {
+    return object->_valid && object->tileset && !object->auto_split 
+        && object->opaque_tiles != NULL && object->chunkset.chunks != NULL;
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 빛을 가로막는지 확인한다. */
+static inline bool IsLightBlocked(LwMap *map, int tile_x, int tile_y) {
+    return (map->_light->opaque[(tile_y * GetSolidRowWords(map)) + (tile_x >> 5)] 
+        & (1u << (tile_x & 31))) != 0;
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 밝기가 저장된 위치를 반환한다. */
+static inline uint8_t *GetLightLevel(LwMap *map, int tile_x, int tile_y) {
+    int chunk_index, relative_tile_index;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    return &map->_light->levels[(chunk_index * map->chunk_width * map->chunk_height) + relative_tile_index];
+}
+
+/* 고유 번호가 `index`인 청크를 밝기가 바뀐 청크의 목록에 추가한다. */
+static inline void MarkLightChunk(LwMap *map, int index) {
+    LwLight *light = map->_light;
+    
+    if (light->changed_listed[index])
+        return;
+    
+    light->changed_listed[index] = true;
+    light->changed_indexes[light->changed_count++] = index;
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 밝기를 `level`로 변경한다. */
+static void SetLightLevel(LwMap *map, int tile_x, int tile_y, int level) {
+    int relative_tile_index;
+    
+    *GetLightLevel(map, tile_x, tile_y) = (uint8_t) level;
+    
+    MarkLightChunk(map, TileXYToChunkIndex(map, map->width.c, tile_x, tile_y, &relative_tile_index));
+}
+
+/* 배열 `queue`의 끝에 `value`를 추가한다. 배열이 가득 찼다면 크기를 두 배로 늘린다. */
+static void PushLightQueue(int **queue, int *count, int *capacity, int value) {
+    if (*count >= *capacity) {
+        *capacity = (*capacity > 0) ? (*capacity * 2) : 64;
+        *queue = (int *) RL_REALLOC(*queue, *capacity * sizeof(int));
+    }
+    
+    (*queue)[(*count)++] = value;
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`이고 밝기가 `level`이었던 타일을 빛을 지울 타일의 목록에 추가한다. */
+static void QueueLightRemoval(LwMap *map, int tile_x, int tile_y, int level) {
+    LwLight *light = map->_light;
+    
+    if (light->removal_count >= light->removal_capacity) {
+        light->removal_capacity = (light->removal_capacity > 0) ? (light->removal_capacity * 2) : 64;
+        light->removals = (LwLightRemoval *) RL_REALLOC(
+            light->removals, 
+            light->removal_capacity * sizeof(LwLightRemoval)
+        );
+    }
+    
+    light->removals[light->removal_count++] = (LwLightRemoval) { 
+        (tile_y * map->width.t) + tile_x, 
+        level 
     };
-}
\ No newline at end of file
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일을 빛을 퍼뜨릴 타일의 목록에 추가한다. */
+static inline void QueueLightTile(LwMap *map, int tile_x, int tile_y) {
+    PushLightQueue(
+        &map->_light->queue, 
+        &map->_light->queue_count, 
+        &map->_light->queue_capacity, 
+        (tile_y * map->width.t) + tile_x
+    );
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 빛을 가로막는지를 다시 계산하고, 바뀌었는지를 반환한다. */
+static bool UpdateOpaqueTile(LwMap *map, int tile_x, int tile_y) {
+    LwObject *object;
+    
+    uint32_t *word, bit = 1u << (tile_x & 31);
+    
+    int chunk_index, relative_tile_index;
+    
+    bool opaque = false, previous;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    for (int i = 0; i < MAX_LAYER_COUNT && !opaque; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0 && !opaque; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (HasOpaqueTiles(object) && object->chunkset.chunks[chunk_index]._valid)
+                opaque = IsOpaqueTileId(object, GetChunkData(map, object, chunk_index)[relative_tile_index]);
+        }
+    }
+    
+    word = &map->_light->opaque[(tile_y * GetSolidRowWords(map)) + (tile_x >> 5)];
+    
+    previous = (*word & bit) != 0;
+    
+    if (opaque)
+        *word |= bit;
+    else
+        *word &= ~bit;
+    
+    return previous != opaque;
+}
+
+/* 게임 맵의 모든 타일이 빛을 가로막는지를 다시 계산하여, 타일마다 1비트씩 저장한다. */
+static void BuildLightOpacity(LwMap *map) {
+    LwObject *object;
+    
+    const int *chunk_data;
+    
+    int *chunk_buffer;
+    
+    int tile_x, tile_y, tile_id;
+    
+    memset(map->_light->opaque, 0, GetSolidRowWords(map) * map->height.t * sizeof(uint32_t));
+    
+    chunk_buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!HasOpaqueTiles(object))
+                continue;
+            
+            for (int k = 0; k < object->chunkset.count; k++) {
+                if (!object->chunkset.chunks[k]._valid)
+                    continue;
+                
+                chunk_data = PeekChunkData(map, object, k, chunk_buffer);
+                
+                for (int l = 0; l < (map->chunk_width * map->chunk_height); l++) {
+                    if ((tile_id = chunk_data[l]) < 0 || !IsOpaqueTileId(object, tile_id))
+                        continue;
+                    
+                    tile_x = (GetMapChunkX(map, k) * map->chunk_width) + (l % map->chunk_width);
+                    tile_y = (GetMapChunkY(map, k) * map->chunk_height) + (l / map->chunk_width);
+                    
+                    if (tile_x > map->width.t - 1 || tile_y > map->height.t - 1)
+                        continue;
+                    
+                    map->_light->opaque[(tile_y * GetSolidRowWords(map)) + (tile_x >> 5)] |= (1u << (tile_x & 31));
+                }
+            }
+        }
+    }
+    
+    RL_FREE(chunk_buffer);
+}
+
+/* 게임 맵의 조명을 만든다. 처음에는 빛이 나오는 타일이 없다. */
+static bool InitLight(LwMap *map) {
+    int chunk_count = map->width.c * map->height.c;
+    
+    if (map->_light != NULL)
+        return true;
+    
+    if (chunk_count <= 0)
+        return false;
+    
+    map->_light = (LwLight *) RL_CALLOC(1, sizeof(LwLight));
+    
+    map->_light->levels = (uint8_t *) RL_CALLOC(
+        chunk_count * map->chunk_width * map->chunk_height, 
+        sizeof(uint8_t)
+    );
+    
+    map->_light->opaque = (uint32_t *) RL_CALLOC(
+        GetSolidRowWords(map) * map->height.t, 
+        sizeof(uint32_t)
+    );
+    
+    map->_light->changed_indexes = (int *) RL_CALLOC(chunk_count, sizeof(int));
+    map->_light->changed_listed = (bool *) RL_CALLOC(chunk_count, sizeof(bool));
+    
+    BuildLightOpacity(map);
+    
+    return true;
+}
+
+/* 
+    빛을 퍼뜨릴 타일의 목록에 있는 타일부터 너비 우선 탐색으로 빛을 퍼뜨린다. 빛을 가로막는 타일도 
+    밝아지지만, 그 타일에서 빛이 더 퍼지지는 않는다.
+*/
+static void PropagateLight(LwMap *map) {
+    static const int offsets[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+    
+    LwLight *light = map->_light;
+    
+    int tile_x, tile_y, next_x, next_y, level;
+    
+    for (int i = 0; i < light->queue_count; i++) {
+        tile_x = light->queue[i] % map->width.t;
+        tile_y = light->queue[i] / map->width.t;
+        
+        if ((level = *GetLightLevel(map, tile_x, tile_y)) <= 1)
+            continue;
+        
+        for (int j = 0; j < 4; j++) {
+            next_x = tile_x + offsets[j][0];
+            next_y = tile_y + offsets[j][1];
+            
+            if (next_x < 0 || next_x > map->width.t - 1 || next_y < 0 || next_y > map->height.t - 1
+                || *GetLightLevel(map, next_x, next_y) >= level - 1)
+                continue;
+            
+            SetLightLevel(map, next_x, next_y, level - 1);
+            
+            if (!IsLightBlocked(map, next_x, next_y))
+                QueueLightTile(map, next_x, next_y);
+        }
+    }
+    
+    light->queue_count = 0;
+}
+
+/* 빛이 나오는 타일 중 밝기가 원래의 밝기보다 어두워진 타일을 빛을 퍼뜨릴 타일의 목록에 다시 추가한다. */
+static void SeedLightSources(LwMap *map) {
+    LwLightSource *source;
+    
+    for (int i = 0; i < map->_light->source_count; i++) {
+        source = &map->_light->sources[i];
+        
+        if (IsLightBlocked(map, source->position.x, source->position.y)
+            || *GetLightLevel(map, source->position.x, source->position.y) >= source->level)
+            continue;
+        
+        SetLightLevel(map, source->position.x, source->position.y, source->level);
+        
+        QueueLightTile(map, source->position.x, source->position.y);
+    }
+}
+
+/* 
+    게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일에서 퍼진 빛을 지운 다음, 지워진 영역의 
+    경계에 남아 있는 빛과 빛이 나오는 타일에서 빛을 다시 퍼뜨린다. 지워진 영역 밖의 타일은 
+    다시 계산하지 않는다.
+*/
+static void RemoveLightFrom(LwMap *map, int tile_x, int tile_y) {
+    static const int offsets[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+    
+    LwLight *light = map->_light;
+    
+    int next_x, next_y, level, next_level;
+    
+    if ((level = *GetLightLevel(map, tile_x, tile_y)) > 0) {
+        SetLightLevel(map, tile_x, tile_y, 0);
+        
+        QueueLightRemoval(map, tile_x, tile_y, level);
+    }
+    
+    for (int i = 0; i < light->removal_count; i++) {
+        tile_x = light->removals[i].index % map->width.t;
+        tile_y = light->removals[i].index / map->width.t;
+        
+        level = light->removals[i].level;
+        
+        for (int j = 0; j < 4; j++) {
+            next_x = tile_x + offsets[j][0];
+            next_y = tile_y + offsets[j][1];
+            
+            if (next_x < 0 || next_x > map->width.t - 1 || next_y < 0 || next_y > map->height.t - 1
+                || (next_level = *GetLightLevel(map, next_x, next_y)) == 0)
+                continue;
+            
+            if (next_level >= level) {
+                /* 다른 곳에서 퍼진 빛이므로, 지워진 영역으로 다시 퍼뜨린다. */
+                if (!IsLightBlocked(map, next_x, next_y))
+                    QueueLightTile(map, next_x, next_y);
+                
+                continue;
+            }
+            
+            SetLightLevel(map, next_x, next_y, 0);
+            
+            if (!IsLightBlocked(map, next_x, next_y)) {
+                QueueLightRemoval(map, next_x, next_y, next_level);
+                
+                continue;
+            }
+            
+            /* 빛을 가로막는 타일은 빛을 퍼뜨리지 않으므로, 그 주변의 빛으로 다시 밝힌다. */
+            for (int k = 0; k < 4; k++) {
+                if (next_x + offsets[k][0] < 0 || next_x + offsets[k][0] > map->width.t - 1
+                    || next_y + offsets[k][1] < 0 || next_y + offsets[k][1] > map->height.t - 1
+                    || IsLightBlocked(map, next_x + offsets[k][0], next_y + offsets[k][1]))
+                    continue;
+                
+                QueueLightTile(map, next_x + offsets[k][0], next_y + offsets[k][1]);
+            }
+        }
+    }
+    
+    light->removal_count = 0;
+    
+    SeedLightSources(map);
+    PropagateLight(map);
+}
+
+/* 
+    밝기가 바뀐 청크를 게임 맵에 맞춰 그려지는 모든 타일셋 개체에 다시 그려야 하는 청크로 표시하여, 
+    정적 레이어와 축소 이미지에서 그 청크만 다시 만들도록 한다.
+*/
+static void FlushLightChunks(LwMap *map) {
+    LwLight *light = map->_light;
+    LwObject *object;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid || !object->tileset || object->auto_split 
+                || object->chunkset.chunks == NULL)
+                continue;
+            
+            for (int k = 0; k < light->changed_count; k++)
+                if (object->chunkset.chunks[light->changed_indexes[k]]._valid)
+                    MarkChunkDirty(map, object, light->changed_indexes[k], LW_DIRTY_RENDER | LW_DIRTY_LOD);
+        }
+    }
+    
+    for (int i = 0; i < light->changed_count; i++)
+        light->changed_listed[light->changed_indexes[i]] = false;
+    
+    light->changed_count = 0;
+}
+
+/* 게임 맵의 모든 타일의 밝기를 처음부터 다시 계산한다. */
+static void RebuildLight(LwMap *map) {
+    int chunk_count = map->width.c * map->height.c;
+    
+    if (map->_light == NULL)
+        return;
+    
+    memset(map->_light->levels, 0, chunk_count * map->chunk_width * map->chunk_height);
+    
+    for (int i = 0; i < chunk_count; i++)
+        MarkLightChunk(map, i);
+    
+    BuildLightOpacity(map);
+    
+    SeedLightSources(map);
+    PropagateLight(map);
+    
+    FlushLightChunks(map);
+}
+
+/* 
+    게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 바뀌었을 때, 그 타일이 빛을 가로막는지가 
+    바뀌었다면 그 타일 주변의 빛만 다시 계산한다.
+*/
+static void UpdateLightTile(LwMap *map, int tile_x, int tile_y) {
+    if (map->_light == NULL || !UpdateOpaqueTile(map, tile_x, tile_y))
+        return;
+    
+    if (IsLightBlocked(map, tile_x, tile_y)) {
+        RemoveLightFrom(map, tile_x, tile_y);
+    } else {
+        /* 빛을 가로막던 타일도 주변의 빛으로 밝아져 있으므로, 그 밝기에서부터 빛을 퍼뜨린다. */
+        QueueLightTile(map, tile_x, tile_y);
+        
+        SeedLightSources(map);
+        PropagateLight(map);
+    }
+    
+    FlushLightChunks(map);
+}
+
+/* 밝기가 `level`인 타일을 그릴 때 사용할 색상을 반환한다. */
+static inline Color GetLightTint(LwMap *map, int level) {
+    unsigned char value = (unsigned char) (
+        (255 * LW_MAX(level, map->_light->ambient)) / MAX_LIGHT_LEVEL
+    );
+    
+    return (Color) { value, value, value, 255 };
+}
+
+/* 타일셋 개체 `object`에서 고유 번호가 `tile_id`인 지형의 자동 타일 규칙 인덱스를 반환한다. */
+static inline int GetTerrainRuleIndex(LwObject *object, int tile_id) {
+    return (tile_id >= 0 && tile_id < object->autotile_lookup_size) 
+        ? object->autotile_lookup[tile_id] 
+        : -1;
+}
+
+/* 
+    타일셋 개체 `object`에서 고유 번호가 `tile_id`인 타일이 속한 자동 타일 규칙의 인덱스를 반환한다. 
+    지형의 고유 번호와 그 지형에서 그리는 타일의 고유 번호를 모두 확인한다.
+*/
+static inline int GetAutotileRuleIndex(LwObject *object, int tile_id) {
+    int rule_index = GetTerrainRuleIndex(object, tile_id);
+    
+    if (rule_index >= 0)
+        return rule_index;
+    
+    return (tile_id >= 0 && tile_id < object->autotile_variant_lookup_size) 
+        ? object->autotile_variant_lookup[tile_id] 
+        : -1;
+}
+
+/* 
+    타일셋 개체 `object`에서 고유 번호가 `tile_id`인 타일의 지형 고유 번호를 반환한다. 
+    자동 타일이 아니라면 `tile_id`를 그대로 반환한다.
+*/
+static inline int GetTerrainId(LwObject *object, int tile_id) {
+    int rule_index = GetAutotileRuleIndex(object, tile_id);
+    
+    return (rule_index >= 0) ? object->autotiles[rule_index].terrain_id : tile_id;
+}
+
+/* 
+    타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 속한 자동 타일 규칙의 인덱스를 반환한다. 
+    게임 맵의 범위를 벗어난 좌표라면 `-2`를 반환한다.
+*/
+static int GetAutotileRuleAt(LwMap *map, LwObject *object, int tile_x, int tile_y) {
+    int chunk_index, relative_tile_index;
+    
+    if (tile_x < 0 || tile_x > map->width.t - 1
+        || tile_y < 0 || tile_y > map->height.t - 1)
+        return -2;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    if (!object->chunkset.chunks[chunk_index]._valid)
+        return -1;
+    
+    return GetAutotileRuleIndex(object, GetChunkData(map, object, chunk_index)[relative_tile_index]);
+}
+
+/* 
+    고유 번호가 `index`인 청크에서 상대적인 인덱스가 `relative_tile_index`이고 고유 번호가 `tile_id`인 
+    타일을, 게임 맵 데이터에 저장할 값으로 반환한다. 라이브러리가 고른 자동 타일은 지형의 고유 번호로 
+    바꾸고, 직접 놓은 타일은 그대로 반환한다.
+*/
+static inline int GetStoredTileId(LwObject *object, int index, int relative_tile_index, int tile_id) {
+    const bool *autotiled = object->chunkset.chunks[index]._autotiled;
+    
+    return (autotiled != NULL && autotiled[relative_tile_index]) 
+        ? GetTerrainId(object, tile_id) 
+        : tile_id;
+}
+
+/* 
+    타일 기준 좌표가 `(tile_x, tile_y)`인 타일이 지형의 고유 번호로 놓인 자동 타일이라면, 주변 타일의 
+    지형에 맞는 타일로 바꾸고 타일이 바뀌었는지를 반환한다. 게임 맵의 바깥은 같은 지형으로 취급한다.
+    지형에서 그리는 타일을 직접 놓은 칸은 주변 타일의 지형을 확인할 때만 사용하며, 다시 고르지 않는다.
+    
+    주변 8칸의 지형이 같은지를 위쪽부터 시계 방향으로 한 비트씩 나타낸 값을 비트마스크로 사용하며, 
+    `LW_AUTOTILE_BLOB47` 방식에서는 양옆의 변이 모두 같은 지형일 때만 모서리를 확인한다. 
+    `tiles`의 `n`번째 타일은, 이렇게 나올 수 있는 47가지 비트마스크를 오름차순으로 정렬했을 때 
+    `n`번째 비트마스크에 해당한다. `LW_AUTOTILE_WANG16` 방식에서는 위, 오른쪽, 아래, 왼쪽의 순서로 
+    한 비트씩 나타낸 값이 그대로 `tiles`의 인덱스가 된다.
+*/
+static bool ResolveAutotile(LwMap *map, LwObject *object, int tile_x, int tile_y) {
+    static const int offsets[8][2] = {
+        { 0, -1 }, { 1, -1 }, { 1, 0 }, { 1, 1 }, 
+        { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }
+    };
+    
+    /* 주변 8칸의 비트마스크를 `LW_AUTOTILE_BLOB47` 방식의 타일 인덱스로 변환하는 표. */
+    static const unsigned char blob_indexes[256] = {
+         0,  1,  0,  1,  2,  3,  2,  4,  0,  1,  0,  1,  2,  3,  2,  4,
+         5,  6,  5,  6,  7,  8,  7,  9,  5,  6,  5,  6, 10, 11, 10, 12,
+         0,  1,  0,  1,  2,  3,  2,  4,  0,  1,  0,  1,  2,  3,  2,  4,
+         5,  6,  5,  6,  7,  8,  7,  9,  5,  6,  5,  6, 10, 11, 10, 12,
+        13, 14, 13, 14, 15, 16, 15, 17, 13, 14, 13, 14, 15, 16, 15, 17,
+        18, 19, 18, 19, 20, 21, 20, 22, 18, 19, 18, 19, 23, 24, 23, 25,
+        13, 14, 13, 14, 15, 16, 15, 17, 13, 14, 13, 14, 15, 16, 15, 17,
+        26, 27, 26, 27, 28, 29, 28, 30, 26, 27, 26, 27, 31, 32, 31, 33,
+         0,  1,  0,  1,  2,  3,  2,  4,  0,  1,  0,  1,  2,  3,  2,  4,
+         5,  6,  5,  6,  7,  8,  7,  9,  5,  6,  5,  6, 10, 11, 10, 12,
+         0,  1,  0,  1,  2,  3,  2,  4,  0,  1,  0,  1,  2,  3,  2,  4,
+         5,  6,  5,  6,  7,  8,  7,  9,  5,  6,  5,  6, 10, 11, 10, 12,
+        13, 34, 13, 34, 15, 35, 15, 36, 13, 34, 13, 34, 15, 35, 15, 36,
+        18, 37, 18, 37, 20, 38, 20, 39, 18, 37, 18, 37, 23, 40, 23, 41,
+        13, 34, 13, 34, 15, 35, 15, 36, 13, 34, 13, 34, 15, 35, 15, 36,
+        26, 42, 26, 42, 28, 43, 28, 44, 26, 42, 26, 42, 31, 45, 31, 46
+    };
+    
+    LwAutotileRule *rule;
+    LwChunk *chunk;
+    
+    int *chunk_data;
+    
+    int chunk_index, relative_tile_index, rule_index, neighbor_index, tile_id;
+    int mask = 0;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    chunk = &object->chunkset.chunks[chunk_index];
+    
+    if (!chunk->_valid)
+        return false;
+    
+    chunk_data = GetChunkData(map, object, chunk_index);
+    
+    if ((rule_index = GetTerrainRuleIndex(object, chunk_data[relative_tile_index])) >= 0) {
+        if (chunk->_autotiled == NULL)
+            chunk->_autotiled = (bool *) RL_CALLOC(map->chunk_width * map->chunk_height, sizeof(bool));
+        
+        chunk->_autotiled[relative_tile_index] = true;
+    } else if (chunk->_autotiled != NULL && chunk->_autotiled[relative_tile_index]) {
+        rule_index = GetAutotileRuleIndex(object, chunk_data[relative_tile_index]);
+    }
+    
+    if (rule_index < 0)
+        return false;
+    
+    rule = &object->autotiles[rule_index];
+    
+    for (int i = 0; i < 8; i++) {
+        if (rule->mode == LW_AUTOTILE_WANG16 && (i & 1))
+            continue;
+        
+        neighbor_index = GetAutotileRuleAt(map, object, tile_x + offsets[i][0], tile_y + offsets[i][1]);
+        
+        if (neighbor_index == rule_index || neighbor_index == -2)
+            mask |= (1 << i);
+    }
+    
+    tile_id = (rule->mode == LW_AUTOTILE_BLOB47)
+        ? rule->tiles[blob_indexes[mask]]
+        : rule->tiles[(mask & 1) | ((mask >> 1) & 2) | ((mask >> 2) & 4) | ((mask >> 3) & 8)];
+    
+    if (chunk_data[relative_tile_index] == tile_id)
+        return false;
+    
+    chunk_data[relative_tile_index] = tile_id;
+    
+    return true;
+}
+
+/* 
+    타일 기준 좌표가 `(min_x, min_y)`부터 `(max_x, max_y)`까지인 범위의 자동 타일을 다시 고른다. 
+    `flags`가 `0`이 아니라면, 타일이 바뀐 청크에 `flags`에 해당하는 변경 사항을 표시한다.
+*/
+static void ResolveAutotileRect(
+    LwMap *map, LwObject *object, 
+    int min_x, int min_y, int max_x, int max_y, 
+    int flags
+) {
+    LwChunkCoord min_chunk, max_chunk;
+    
+    int chunk_index, relative_tile_index;
+    
+    if (object->autotile_count <= 0 || object->chunkset.chunks == NULL
+        || !object->tileset || object->auto_split)
+        return;
+    
+    min_x = LW_MAX(min_x, 0);
+    min_y = LW_MAX(min_y, 0);
+    
+    max_x = LW_MIN(max_x, map->width.t - 1);
+    max_y = LW_MIN(max_y, map->height.t - 1);
+    
+    for (int tile_y = min_y; tile_y <= max_y; tile_y++) {
+        for (int tile_x = min_x; tile_x <= max_x; tile_x++) {
+            if (!ResolveAutotile(map, object, tile_x, tile_y) || flags == 0)
+                continue;
+            
+            chunk_index = TileXYToChunkIndex(
+                map, map->width.c, 
+                tile_x, tile_y, 
+                &relative_tile_index
+            );
+            
+            MarkChunkDirty(map, object, chunk_index, flags);
+            
+            if (object->solid_tiles != NULL)
+                UpdateSolidTile(map, tile_x, tile_y);
+            
+            if (object->opaque_tiles != NULL)
+                UpdateLightTile(map, tile_x, tile_y);
+        }
+    }
+    
+    if (flags == 0 || object->animation_count <= 0 || min_x > max_x || min_y > max_y)
+        return;
+    
+    /* 애니메이션이 있는 타일로 바뀌었을 수도 있으므로, 범위와 겹치는 청크의 목록을 다시 만든다. */
+    min_chunk = TileXYToChunkCoord(map, min_x, min_y);
+    max_chunk = TileXYToChunkCoord(map, max_x, max_y);
+    
+    for (int chunk_y = min_chunk.y; chunk_y <= max_chunk.y; chunk_y++) {
+        for (int chunk_x = min_chunk.x; chunk_x <= max_chunk.x; chunk_x++) {
+            chunk_index = (chunk_y * map->width.c) + chunk_x;
+            
+            if (object->chunkset.chunks[chunk_index]._valid)
+                UpdateAnimatedTiles(map, object, chunk_index, GetChunkData(map, object, chunk_index));
+        }
+    }
+}
+
+/* 
+    고유 번호가 `index`인 청크의 타일 데이터를, 게임 맵 데이터에 저장할 값으로 반환한다. 
+    라이브러리가 고른 자동 타일은 지형의 고유 번호로 바꾸어 `buffer`에 저장한다.
+*/
+static const int *GetStoredChunkData(LwMap *map, LwObject *object, int index, int *buffer) {
+    const int *chunk_data = PeekChunkData(map, object, index, buffer);
+    
+    if (object->autotile_count <= 0)
+        return chunk_data;
+    
+    for (int i = 0; i < (map->chunk_width * map->chunk_height); i++)
+        buffer[i] = GetStoredTileId(object, index, i, chunk_data[i]);
+    
+    return buffer;
+}
+
+/* 
+    개체의 타일 데이터를 청크 배열로 변환하여, `object.chunkset.chunks`에 저장한다.
+    
+    타일셋 개체의 `tiledata`는 게임 맵 전체의 타일 고유 번호를 나열한 배열이거나, 
+    청크마다 압축된 타일 데이터를 Base64 문자열로 나열한 배열이다.
+*/
+static bool LoadTileData(LwMap *map, LwObject *object, JsonNode *node_tiledata) {
+    JsonNode *node_tile;
+    
+    LwChunk *chunk;
+    
+    int chunk_index, relative_tile_index;
+    int abs_tile_index = 0;
+    
+    if (!object->tileset && !object->auto_split) {
+        return true;
+    } else if (object->tileset && !object->auto_split) {
+        object->position = (Vector2) { 0 };
+        
+        InitChunkSet(map, object, map->width.c * map->height.c);
+        
+        node_tile = json_first_child(node_tiledata);
+        
+        if (node_tile != NULL && node_tile->tag == JSON_STRING) {
+            chunk_index = 0;
+            
+            json_foreach(node_tile, node_tiledata) {
+                if (chunk_index > object->chunkset.count - 1)
+                    break;
+                
+                chunk = &object->chunkset.chunks[chunk_index++];
+                
+                if (node_tile->tag != JSON_STRING || TextLength(node_tile->string_) == 0)
+                    continue;
+                
+                if (!DecodeTileDataString(node_tile->string_, chunk->data, map->chunk_width * map->chunk_height))
+                    return false;
+                
+                for (int i = 0; i < (map->chunk_width * map->chunk_height) && !chunk->_valid; i++)
+                    if (chunk->data[i] >= 0)
+                        chunk->_valid = true;
+            }
+            
+            return true;
+        }
+        
+        json_foreach(node_tile, node_tiledata) {
+            if (abs_tile_index > (map->width.t * map->height.t) - 1)
+                break;
+            
+            if ((int) node_tile->number_ < 0) {
+                abs_tile_index++;
+                
+                continue;
+            }
+            
+            chunk_index = TileXYToChunkIndex(
+                map, map->width.c,
+                GetMapTileX(map, abs_tile_index), GetMapTileY(map, abs_tile_index),
+                &relative_tile_index
+            );
+            
+            if (!object->chunkset.chunks[chunk_index]._valid)
+                object->chunkset.chunks[chunk_index]._valid = true;
+            
+            object->chunkset.chunks[chunk_index]
+                .data[relative_tile_index] = (int) node_tile->number_;
+            
+            abs_tile_index++;
+        }
+        
+        return true;
+    } else if (!object->tileset && object->auto_split) {
+        InitChunkSet(map, object, object->width.c * object->height.c);
+        
+        for (abs_tile_index = 0; 
+             abs_tile_index < (object->width.t * object->height.t); 
+             abs_tile_index++) {
+            chunk_index = TileXYToChunkIndex(
+                map, object->width.c,
+                GetObjectTileX(object, abs_tile_index), GetObjectTileY(object, abs_tile_index),
+                &relative_tile_index
+            );
+            
+            if (!object->chunkset.chunks[chunk_index]._valid)
+                object->chunkset.chunks[chunk_index]._valid = true;
+            
+            object->chunkset.chunks[chunk_index]
+                .data[relative_tile_index] = abs_tile_index;
+        }
+        
+        return true;
+    } else {
+        return false;
+    }
+}
+
+/* 아직 불러오지 않은 개체의 타일 데이터를, `map._source`에 기록된 위치에서 불러온다. */
+static bool LoadObjectTileData(LwMap *map, LwObject *object) {
+    JsonArena *arena;
+    JsonNode *node_tiledata;
+    
+    const char *tiledata;
+    
+    bool result = true;
+    
+    if (object->tiledata_offset < 0)
+        return true;
+    
+    arena = json_arena_new();
+    
+    tiledata = map->_source + object->tiledata_offset;
+    
+    if ((node_tiledata = json_decode_value(&tiledata, arena)) == NULL
+        || !LoadTileData(map, object, node_tiledata)) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to load `tiledata` for object #%d",
+            map->name,
+            object->id
+        );
+        
+        result = false;
+    }
+    
+    json_arena_free(arena);
+    
+    object->tiledata_offset = -1;
+    
+    if (result) {
+        ResolveAutotileRect(map, object, 0, 0, map->width.t - 1, map->height.t - 1, LW_DIRTY_NONE);
+        
+        BuildAnimatedTiles(map, object);
+    }
+    
+    return result;
+}
+
+/* 
+    고유 번호가 `index`인 개체를 레이어의 개체 목록에 추가한다. `sorted`가 `true`이면 
+    고유 번호의 순서에 맞는 위치에, 아니라면 목록의 맨 끝에 추가한다.
+*/
+static void LinkObject(LwLayer *layer, int index, bool sorted) {
+    int prev_index = layer->_last_object;
+    
+    if (sorted)
+        while (prev_index >= 0 && prev_index > index)
+            prev_index = layer->objects[prev_index]._prev;
+    
+    layer->objects[index]._prev = prev_index;
+    layer->objects[index]._next = (prev_index >= 0) 
+        ? layer->objects[prev_index]._next 
+        : layer->_first_object;
+    
+    if (prev_index >= 0)
+        layer->objects[prev_index]._next = index;
+    else
+        layer->_first_object = index;
+    
+    if (layer->objects[index]._next >= 0)
+        layer->objects[layer->objects[index]._next]._prev = index;
+    else
+        layer->_last_object = index;
+}
+
+/* 고유 번호가 `index`인 개체를 레이어의 개체 목록에서 제거한다. */
+static void UnlinkObject(LwLayer *layer, int index) {
+    LwObject *object = &layer->objects[index];
+    
+    if (object->_prev >= 0)
+        layer->objects[object->_prev]._next = object->_next;
+    else
+        layer->_first_object = object->_next;
+    
+    if (object->_next >= 0)
+        layer->objects[object->_next]._prev = object->_prev;
+    else
+        layer->_last_object = object->_prev;
+    
+    object->_prev = object->_next = -1;
+}
+
+/* 개체 `object`의 청크 배열에 할당된 메모리를 모두 해제한다. */
+static void UnloadChunkSet(LwObject *object) {
+    if (object->chunkset.chunks == NULL)
+        return;
+    
+    RL_FREE(object->chunkset.indexes);
+    
+    for (int i = 0; i < object->chunkset.count; i++) {
+        RL_FREE(object->chunkset.chunks[i].data);
+        RL_FREE(object->chunkset.chunks[i].packed);
+        RL_FREE(object->chunkset.chunks[i].animated_tiles);
+        RL_FREE(object->chunkset.chunks[i]._autotiled);
+    }
+    
+    RL_FREE(object->chunkset.chunks);
+    RL_FREE(object->chunkset.dirty_indexes);
+    RL_FREE(object->chunkset.animated_indexes);
+    
+    object->chunkset = (LwChunkSet) { 0 };
+}
+
+/* 개체 `object`에 할당된 메모리를 모두 해제한다. */
+static void UnloadObjectData(LwObject *object) {
+    RL_FREE(object->image_path);
+    RL_FREE(object->solid_tiles);
+    RL_FREE(object->opaque_tiles);
+    
+    for (int i = 0; i < object->animation_count; i++) {
+        RL_FREE(object->animations[i].frames);
+        RL_FREE(object->animations[i].durations);
+    }
+    
+    RL_FREE(object->animations);
+    RL_FREE(object->animation_lookup);
+    
+    for (int i = 0; i < object->autotile_count; i++)
+        RL_FREE(object->autotiles[i].tiles);
+    
+    RL_FREE(object->autotiles);
+    RL_FREE(object->autotile_lookup);
+    RL_FREE(object->autotile_variant_lookup);
+    RL_FREE(object->tile_colors);
+    
+    UnloadChunkSet(object);
+}
+
+/* 
+    타일의 고유 번호 배열 `node_tile_ids`를 비트 배열로 변환하여 반환하고, 비트 배열에 저장할 수 있는 
+    타일 고유 번호의 개수를 `count`에 저장한다. (`solid_tiles`, `opaque_tiles`)
+*/
+static uint32_t *LoadTileIdBits(JsonNode *node_tile_ids, int *count) {
+    JsonNode *node_tile_id;
+    
+    uint32_t *bits;
+    
+    int tile_id;
+    
+    *count = 0;
+    
+    json_foreach(node_tile_id, node_tile_ids)
+        if ((int) node_tile_id->number_ + 1 > *count)
+            *count = (int) node_tile_id->number_ + 1;
+    
+    bits = (uint32_t *) RL_CALLOC((*count + 31) >> 5, sizeof(uint32_t));
+    
+    json_foreach(node_tile_id, node_tile_ids)
+        if ((tile_id = (int) node_tile_id->number_) >= 0)
+            bits[tile_id >> 5] |= (1u << (tile_id & 31));
+    
+    return bits;
+}
+
+/* 타일 고유 번호의 비트 배열 `bits`를 타일의 고유 번호 배열 노드로 변환하여 반환한다. */
+static JsonNode *SaveTileIdBits(const uint32_t *bits, int count) {
+    JsonNode *node_tile_ids = json_mkarray();
+    
+    for (int i = 0; i < count; i++)
+        if (bits[i >> 5] & (1u << (i & 31)))
+            json_append_element(node_tile_ids, json_mknumber(i));
+    
+    return node_tile_ids;
+}
+
+/* 
+    개체의 `animations` 노드에 포함된 타일 애니메이션 데이터를 불러온다. `duration_ms`는 모든 
+    프레임에 사용할 하나의 값이거나 프레임마다의 값을 나타내는 배열이며, 배열의 길이가 프레임의 
+    개수보다 짧다면 마지막 값을 나머지 프레임에 사용한다.
+*/
+static bool LoadAnimationsData(LwMap *map, LwObject *object, JsonNode *node_animations) {
+    JsonNode *node_animation, *node_member, *node_value;
+    
+    LwTileAnimation *animation;
+    
+    int count = 0, index, duration;
+    
+    if (object->animations != NULL)
+        return true;
+    
+    json_foreach(node_animation, node_animations)
+        count++;
+    
+    object->animations = (LwTileAnimation *) RL_CALLOC(count, sizeof(LwTileAnimation));
+    
+    json_foreach(node_animation, node_animations) {
+        animation = &object->animations[object->animation_count++];
+        
+        animation->tile_id = -1;
+        
+        json_foreach(node_member, node_animation) {
+            LwKey key = GetKeyType(node_member->key);
+            
+            if (key == LW_KEY_ID) {
+                animation->tile_id = (int) node_member->number_;
+            } else if (key == LW_KEY_FRAMES) {
+                json_foreach(node_value, node_member)
+                    animation->frame_count++;
+                
+                animation->frames = (int *) RL_CALLOC(animation->frame_count, sizeof(int));
+                
+                index = 0;
+                
+                json_foreach(node_value, node_member)
+                    animation->frames[index++] = (int) node_value->number_;
+            }
+        }
+        
+        animation->durations = (int *) RL_CALLOC(LW_MAX(animation->frame_count, 1), sizeof(int));
+        
+        node_member = json_find_member(node_animation, "duration_ms");
+        
+        node_value = (node_member != NULL && node_member->tag == JSON_ARRAY) 
+            ? json_first_child(node_member) 
+            : node_member;
+        
+        duration = 0;
+        
+        for (int i = 0; i < animation->frame_count; i++) {
+            if (node_value != NULL) {
+                duration = (int) node_value->number_;
+                
+                node_value = (node_member->tag == JSON_ARRAY) ? node_value->next : NULL;
+            }
+            
+            if (duration <= 0) {
+                animation->total_duration = 0;
+                
+                break;
+            }
+            
+            animation->durations[i] = duration;
+            animation->total_duration += duration;
+        }
+        
+        if (animation->tile_id < 0 || animation->frame_count <= 0 || animation->total_duration <= 0) {
+            TraceLog(
+                LOG_ERROR, 
+                "LOWEL: [MAP '%s'] Failed to load map data: invalid value "
+                "for `animations` in object #%d",
+                map->name,
+                object->id
+            );
+            
+            return false;
+        }
+        
+        if (animation->tile_id + 1 > object->animation_lookup_size)
+            object->animation_lookup_size = animation->tile_id + 1;
+    }
+    
+    object->animation_lookup = (int *) RL_MALLOC(object->animation_lookup_size * sizeof(int));
+    
+    for (int i = 0; i < object->animation_lookup_size; i++)
+        object->animation_lookup[i] = -1;
+    
+    for (int i = 0; i < object->animation_count; i++)
+        object->animation_lookup[object->animations[i].tile_id] = i;
+    
+    return true;
+}
+
+/* 
+    자동 타일 규칙 `rule`의 지형과 타일의 고유 번호가, 개체 `object`에 이미 등록된 다른 규칙의 
+    고유 번호와 겹치지 않는지 확인한다.
+*/
+static bool IsAutotileRuleDistinct(LwObject *object, const LwAutotileRule *rule) {
+    int tile_id;
+    
+    if (GetAutotileRuleIndex(object, rule->terrain_id) >= 0)
+        return false;
+    
+    for (int i = 0; i < rule->tile_count; i++) {
+        if ((tile_id = rule->tiles[i]) < 0)
+            continue;
+        
+        if (GetAutotileRuleIndex(object, tile_id) >= 0)
+            return false;
+    }
+    
+    return true;
+}
+
+/* 
+    개체의 `autotiles` 노드에 포함된 자동 타일 규칙을 불러온다. `mode`는 `"blob47"` 또는 `"wang16"`이며, 
+    `tiles`에는 각각 47개 또는 16개의 타일 고유 번호가 있어야 한다. 다른 규칙과 지형이나 타일의 
+    고유 번호가 겹치는 규칙은 어느 규칙을 따를지 정할 수 없으므로, 경고를 출력하고 불러오지 않는다.
+*/
+static bool LoadAutotilesData(LwMap *map, LwObject *object, JsonNode *node_autotiles) {
+    JsonNode *node_autotile, *node_member, *node_value;
+    
+    LwAutotileRule *rule;
+    
+    int count = 0, index;
+    
+    if (object->autotiles != NULL)
+        return true;
+    
+    json_foreach(node_autotile, node_autotiles)
+        count++;
+    
+    object->autotiles = (LwAutotileRule *) RL_CALLOC(count, sizeof(LwAutotileRule));
+    
+    json_foreach(node_autotile, node_autotiles) {
+        rule = &object->autotiles[object->autotile_count++];
+        
+        rule->terrain_id = -1;
+        rule->mode = LW_AUTOTILE_BLOB47;
+        
+        json_foreach(node_member, node_autotile) {
+            LwKey key = GetKeyType(node_member->key);
+            
+            if (key == LW_KEY_ID) {
+                rule->terrain_id = (int) node_member->number_;
+            } else if (key == LW_KEY_MODE) {
+                rule->mode = (node_member->tag == JSON_STRING && TextIsEqual(node_member->string_, "wang16")) 
+                    ? LW_AUTOTILE_WANG16 
+                    : LW_AUTOTILE_BLOB47;
+            } else if (key == LW_KEY_TILES) {
+                json_foreach(node_value, node_member)
+                    rule->tile_count++;
+                
+                rule->tiles = (int *) RL_CALLOC(rule->tile_count, sizeof(int));
+                
+                index = 0;
+                
+                json_foreach(node_value, node_member)
+                    rule->tiles[index++] = (int) node_value->number_;
+            }
+        }
+        
+        if (rule->terrain_id < 0 
+            || rule->tile_count != ((rule->mode == LW_AUTOTILE_BLOB47) ? 47 : 16)) {
+            TraceLog(
+                LOG_ERROR, 
+                "LOWEL: [MAP '%s'] Failed to load map data: invalid value "
+                "for `autotiles` in object #%d",
+                map->name,
+                object->id
+            );
+            
+            return false;
+        }
+        
+        object->autotile_lookup_size = LW_MAX(object->autotile_lookup_size, rule->terrain_id + 1);
+        
+        for (int i = 0; i < rule->tile_count; i++)
+            object->autotile_variant_lookup_size = LW_MAX(
+                object->autotile_variant_lookup_size, 
+                rule->tiles[i] + 1
+            );
+    }
+    
+    object->autotile_lookup = (int *) RL_MALLOC(object->autotile_lookup_size * sizeof(int));
+    object->autotile_variant_lookup = (int *) RL_MALLOC(object->autotile_variant_lookup_size * sizeof(int));
+    
+    for (int i = 0; i < object->autotile_lookup_size; i++)
+        object->autotile_lookup[i] = -1;
+    
+    for (int i = 0; i < object->autotile_variant_lookup_size; i++)
+        object->autotile_variant_lookup[i] = -1;
+    
+    count = object->autotile_count;
+    
+    object->autotile_count = 0;
+    
+    for (int i = 0; i < count; i++) {
+        rule = &object->autotiles[i];
+        
+        if (!IsAutotileRuleDistinct(object, rule)) {
+            TraceLog(
+                LOG_WARNING, 
+                "LOWEL: [MAP '%s'] Ignoring rule #%d of `autotiles` in object #%d: "
+                "its tile IDs overlap with another rule",
+                map->name,
+                i,
+                object->id
+            );
+            
+            RL_FREE(rule->tiles);
+            
+            continue;
+        }
+        
+        index = object->autotile_count++;
+        
+        object->autotiles[index] = *rule;
+        object->autotile_lookup[rule->terrain_id] = index;
+        
+        for (int j = 0; j < rule->tile_count; j++)
+            if (rule->tiles[j] >= 0)
+                object->autotile_variant_lookup[rule->tiles[j]] = index;
+    }
+    
+    return true;
+}
+
+/* 게임 맵 레이어의 `objects` 노드에 포함된 데이터를 불러온다. */
+static bool LoadObjectsData(LwMap *map, JsonNode *node_layer, int layer_id) {
+    JsonNode *node_objects, *node_object;
+    JsonNode *node_offset, *node_tiledata;
+    
+    LwObject *object;
+    
+    int object_id = -1;
+    
+    json_foreach(node_objects, node_layer) {
+        /* 다른 속성보다 고유 번호가 나중에 나오더라도 개체를 불러올 수 있도록, 고유 번호를 먼저 찾는다. */
+        node_object = json_find_member(node_objects, "id");
+        node_tiledata = NULL;
+        
+        object_id = (node_object != NULL && node_object->tag == JSON_NUMBER)
+            ? (int) node_object->number_
+            : -1;
+        
+        if (object_id < 0 || object_id > MAX_OBJECT_COUNT - 1 
+            || GetObject(map, object_id) != NULL) {
+            TraceLog(
+                LOG_ERROR, 
+                "LOWEL: [MAP '%s'] Failed to load map data: invalid value "
+                "for `object_id` in `objects`",
+                map->name
+            );
+            
+            return false;
+        }
+        
+        object = &map->layers[layer_id].objects[object_id];
+        
+        map->object_table[object_id] = layer_id;
+        
+        object->_valid = true;
+        object->id = object_id;
+        object->loaded = !map->lazy_load;
+        object->scale = 1.0;
+        object->tiledata_offset = -1;
+        
+        LinkObject(&map->layers[layer_id], object_id, true);
+        
+        json_foreach(node_object, node_objects) {
+            LwKey key = GetKeyType(node_object->key);
+            
+            switch (key) {
+                case LW_KEY_IMAGE:
+                    object->image_path = (char *) RL_CALLOC(
+                        MAX_STRING_LENGTH,
+                        sizeof(char)
+                    );
+
+                    TextCopy(object->image_path, node_object->string_);
+
+                    if (map->load_texture != NULL && object->loaded) {
+                        TraceLog(
+                            LOG_INFO, 
+                            "LOWEL: [MAP '%s': %s] Attempting to load texture for object #%d",
+                            map->name,
+                            object->image_path,
+                            object_id
+                        );
+
+                        object->texture = map->load_texture(object->image_path);
+                    }
+                    
+                    break;
+                    
+                case LW_KEY_TILESET:
+                    object->tileset = node_object->bool_;
+                    break;
+                    
+                case LW_KEY_AUTO_SPLIT:
+                    object->auto_split = node_object->bool_;
+                    break;
+                    
+                case LW_KEY_SCALE_MUL:
+                    object->scale = node_object->number_;
+                    break;
+                    
+                case LW_KEY_IMAGE_WIDTH:
+                    object->image_width = (int) node_object->number_;
+                    break;
+                    
+                case LW_KEY_IMAGE_HEIGHT:
+                    object->image_height = (int) node_object->number_;
+                    break;
+                    
+                case LW_KEY_ROTATION_DEG:
+                    object->rotation = node_object->number_;
+                    break;
+                    
+                case LW_KEY_POSITION:
+                    json_foreach(node_offset, node_object) {
+                        key = GetKeyType(node_offset->key);
+                        
+                        if (key == LW_KEY_X)
+                            object->position.x = node_offset->number_;
+                        else if (key == LW_KEY_Y)
+                            object->position.y = node_offset->number_;
+                    }
+                    
+                    break;
+                    
+                case LW_KEY_SOLID_TILES:
+                    RL_FREE(object->solid_tiles);
+                    
+                    object->solid_tiles = LoadTileIdBits(node_object, &object->solid_tile_count);
+                    
+                    break;
+                    
+                case LW_KEY_OPAQUE_TILES:
+                    RL_FREE(object->opaque_tiles);
+                    
+                    object->opaque_tiles = LoadTileIdBits(node_object, &object->opaque_tile_count);
+                    
+                    break;
+                    
+                case LW_KEY_ANIMATIONS:
+                    if (!LoadAnimationsData(map, object, node_object))
+                        return false;
+                    
+                    break;
+                    
+                case LW_KEY_AUTOTILES:
+                    if (!LoadAutotilesData(map, object, node_object))
+                        return false;
+                    
+                    break;
+                    
+                case LW_KEY_TILEDATA:
+                    /* 타일 데이터는 개체의 크기를 알아야 불러올 수 있으므로, 마지막에 불러온다. */
+                    node_tiledata = node_object;
+                    break;
+                    
+                default:
+                    break;
+            }
+        }
+        
+        /* 텍스처를 불러오지 않았다면, 게임 맵에 기록된 크기나 이미지 파일의 헤더로 크기를 알아낸다. */
+        if (!object->texture.id && (object->image_width <= 0 || object->image_height <= 0)
+            && object->image_path != NULL)
+            ReadImageSize(object->image_path, &object->image_width, &object->image_height);
+        
+        UpdateObjectSize(map, object);
+        
+        if (node_tiledata == NULL)
+            continue;
+        
+        /* 아직 불러오지 않을 타일 데이터는, 원본 데이터에서의 위치만 기록해둔다. */
+        if (node_tiledata->tag == JSON_RAW) {
+            object->tiledata_offset = (int) (node_tiledata->raw_ - map->_source);
+            
+            continue;
+        }
+        
+        if (!LoadTileData(map, object, node_tiledata)) {
+            TraceLog(
+                LOG_ERROR, 
+                "LOWEL: [MAP '%s'] Failed to load map data: unable to load "
+                "`tiledata` for object #%d",
+                map->name,
+                object_id
+            );
+
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+/* 
+    고유 번호가 `layer_id`인 레이어를 사용할 수 있도록 초기화한다. 개체의 고유 번호는 게임 맵 
+    안에서 겹치지 않으므로, 레이어마다 개체 배열을 만들지 않고 `map._pool`의 배열을 함께 사용한다.
+*/
+static void InitLayer(LwMap *map, int layer_id) {
+    LwLayer *layer = &map->layers[layer_id];
+    
+    if (layer->objects != NULL)
+        return;
+    
+    layer->_valid = true;
+    layer->parallax = (Vector2) { 1.0f, 1.0f };
+    
+    layer->objects = map->_pool->objects;
+    layer->_first_object = layer->_last_object = -1;
+}
+
+/* 게임 맵에서 사용되지 않는 개체의 고유 번호를 모두 `map._pool`에 저장한다. */
+static void InitObjectPool(LwMap *map) {
+    /* 고유 번호가 작은 것부터 먼저 사용할 수 있도록, 큰 것부터 저장한다. */
+    for (int i = MAX_OBJECT_COUNT - 1; i >= 0; i--) {
+        map->_pool->generations[i] = 1;
+        
+        if (GetObject(map, i) == NULL)
+            map->_pool->free_ids[map->_pool->free_count++] = i;
+    }
+}
+
+/* 게임 맵의 `layers` 노드에 포함된 데이터를 불러온다. */
+static bool LoadLayersData(LwMap *map, JsonNode **node_current) {
+    JsonNode *node_layers, *node_layer, *node_offset;
+    
+    int layer_id = -1;
+    
+    map->layers = (LwLayer *) RL_CALLOC(
+        MAX_LAYER_COUNT, 
+        sizeof(LwLayer)
+    );
+    
+    map->object_table = (int *) RL_CALLOC(
+        MAX_OBJECT_COUNT,
+        sizeof(int)
+    );
+    
+    map->_pool = (LwObjectPool *) RL_CALLOC(1, sizeof(LwObjectPool));
+    
+    map->_pool->objects = (LwObject *) RL_CALLOC(
+        MAX_OBJECT_COUNT, 
+        sizeof(LwObject)
+    );
+    
+    json_foreach(node_layers, *node_current) {
+        json_foreach(node_layer, node_layers) {
+            LwKey key = GetKeyType(node_layer->key);
+            
+            if (key == LW_KEY_ID) {
+                layer_id = (int) node_layer->number_;
+                
+                if (layer_id < 0 || layer_id > MAX_LAYER_COUNT - 1) {
+                    TraceLog(
+                        LOG_ERROR, 
+                        "LOWEL: [MAP '%s'] Failed to load map data: invalid value "
+                        "for `layer_id` in `layers`",
+                        map->name
+                    );
+                    
+                    return false;
+                }
+                
+                InitLayer(map, layer_id);
+            } else if (layer_id >= 0) {
+                if (key == LW_KEY_STATIC) {
+                    map->layers[layer_id].is_static = node_layer->bool_;
+                } else if (key == LW_KEY_PARALLAX) {
+                    json_foreach(node_offset, node_layer) {
+                        key = GetKeyType(node_offset->key);
+                        
+                        if (key == LW_KEY_X)
+                            map->layers[layer_id].parallax.x = node_offset->number_;
+                        else if (key == LW_KEY_Y)
+                            map->layers[layer_id].parallax.y = node_offset->number_;
+                    }
+                } else if (key == LW_KEY_OBJECTS) {
+                    if (!LoadObjectsData(map, node_layer, layer_id))
+                        return false;
+                }
+            }
+        }
+    }
+    
+    InitObjectPool(map);
+    
+    return true;
+}
+
+/* 게임 맵의 `header` 노드에 해당하는 부분을 저장한다. */
+static bool SaveHeaderData(LwMap *map, JsonNode *node_root) {
+    JsonNode *node_header;
+    
+    node_header = json_mkobject();
+    
+    json_append_member(node_header, "name", json_mkstring(map->name));
+    json_append_member(node_header, "format_version", json_mkstring(MAP_FORMAT_VERSION));
+    
+    json_append_member(node_root, "header", node_header);
+    
+    return true;
+}
+
+/* 게임 맵의 `options` 노드에 해당하는 부분을 저장한다. */
+static bool SaveOptionsData(LwMap *map, JsonNode *node_root) {
+    JsonNode *node_options;
+    
+    node_options = json_mkobject();
+    
+    json_append_member(node_options, "width", json_mknumber(map->width.px));
+    json_append_member(node_options, "height", json_mknumber(map->height.px));
+    json_append_member(node_options, "tile_width", json_mknumber(map->tile_width));
+    json_append_member(node_options, "tile_height", json_mknumber(map->tile_height));
+    json_append_member(node_options, "chunk_width_t", json_mknumber(map->chunk_width));
+    json_append_member(node_options, "chunk_height_t", json_mknumber(map->chunk_height));
+    json_append_member(node_options, "draw_distance_c", json_mknumber(map->draw_distance));
+    
+    json_append_member(node_root, "options", node_options);
+    
+    return true;
+}
+
+/* 
+    고유 번호가 `index`인 청크의 타일 데이터를 `map.compression`에 해당하는 방식으로 변환한다.
+    압축하지 않을 경우 타일 고유 번호의 배열을, 압축할 경우 Base64 문자열을 반환한다.
+*/
+static JsonNode *SaveChunkData(LwMap *map, LwObject *object, int index, int *buffer) {
+    JsonNode *node_tiledata;
+    
+    LwChunk *chunk = &object->chunkset.chunks[index];
+    
+    const int *chunk_data;
+    
+    char *string;
+    
+    if (map->compression == LW_COMPRESSION_NONE) {
+        node_tiledata = json_mkarray();
+        
+        chunk_data = GetStoredChunkData(map, object, index, buffer);
+        
+        for (int i = 0; i < (map->chunk_width * map->chunk_height); i++)
+            json_append_element(node_tiledata, json_mknumber(chunk_data[i]));
+        
+        return node_tiledata;
+    }
+    
+    /* 
+        같은 방식으로 이미 압축된 청크는 압축된 데이터를 그대로 사용한다. 
+        자동 타일이 있는 개체는 지형의 고유 번호로 바꾸어 저장해야 하므로, 다시 압축한다.
+    */
+    if (chunk->data == NULL && chunk->packed[0] == (unsigned char) map->compression
+        && object->autotile_count <= 0) {
+        string = EncodeBase64(chunk->packed, chunk->packed_size);
+    } else {
+        string = EncodeTileDataString(
+            GetStoredChunkData(map, object, index, buffer), 
+            map->chunk_width * map->chunk_height, 
+            map->compression
+        );
+    }
+    
+    node_tiledata = json_mkstring(string);
+    
+    RL_FREE(string);
+    
+    return node_tiledata;
+}
+
+/* 게임 맵의 `layers` 노드에 해당하는 부분을 저장한다. */
+static bool SaveLayersData(LwMap *map, JsonNode *node_root) {
+    JsonNode *node_layers, *node_layer, *node_parallax;
+    JsonNode *node_objects, *node_object;
+    JsonNode *node_position, *node_tiledata;
+    JsonNode *node_animations, *node_animation;
+    JsonNode *node_frames, *node_durations;
+    JsonNode *node_autotiles, *node_autotile, *node_tiles;
+    
+    LwObject *object;
+    
+    const int *chunk_data = NULL;
+    
+    int *chunk_buffer;
+    
+    int chunk_index, relative_tile_index, cached_index;
+    
+    chunk_buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+    
+    node_layers = json_mkarray();
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        node_layer = json_mkobject();
+        node_objects = json_mkarray();
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            if (!map->layers[i].objects[j]._valid)
+                continue;
+            
+            node_object = json_mkobject();
+            
+            node_position = json_mkobject();
+            node_tiledata = json_mkarray();
+            
+            json_append_member(
+                node_position, 
+                "x", 
+                json_mknumber(map->layers[i].objects[j].position.x)
+            );
+            json_append_member(
+                node_position, 
+                "y", 
+                json_mknumber(map->layers[i].objects[j].position.y)
+            );
+            
+            object = &map->layers[i].objects[j];
+            
+            if (!object->loaded && object->tiledata_offset >= 0) {
+                /* 아직 불러오지 않은 타일 데이터는, 원본 데이터를 그대로 저장한다. */
+                json_delete(node_tiledata);
+                
+                node_tiledata = json_mkraw(map->_source + object->tiledata_offset);
+            } else if (object->tileset && !object->auto_split) {
+                if (map->compression != LW_COMPRESSION_NONE) {
+                    for (int k = 0; k < object->chunkset.count; k++) {
+                        if (!object->chunkset.chunks[k]._valid) {
+                            json_append_element(node_tiledata, json_mkstring(""));
+                            
+                            continue;
+                        }
+                        
+                        json_append_element(node_tiledata, SaveChunkData(map, object, k, chunk_buffer));
+                    }
+                } else {
+                    cached_index = -1;
+                    
+                    for (int k = 0; k < map->width.t * map->height.t; k++) {
+                        chunk_index = TileXYToChunkIndex(
+                            map, map->width.c, 
+                            GetMapTileX(map, k), GetMapTileY(map, k), 
+                            &relative_tile_index
+                        );
+                        
+                        if (chunk_index != cached_index) {
+                            chunk_data = GetStoredChunkData(map, object, chunk_index, chunk_buffer);
+                            
+                            cached_index = chunk_index;
+                        }
+                        
+                        json_append_element(
+                            node_tiledata, 
+                            json_mknumber(chunk_data[relative_tile_index])
+                        );
+                    }
+                }
+            }
+            
+            json_append_member(
+                node_object, 
+                "id", 
+                json_mknumber(j)
+            );
+            json_append_member(
+                node_object, 
+                "image", 
+                json_mkstring(map->layers[i].objects[j].image_path)
+            );
+            
+            /* 텍스처를 불러오지 않는 환경에서도 개체의 크기를 알 수 있도록, 이미지 크기를 함께 저장한다. */
+            if (object->image_width > 0 && object->image_height > 0) {
+                json_append_member(node_object, "image_width", json_mknumber(object->image_width));
+                json_append_member(node_object, "image_height", json_mknumber(object->image_height));
+            }
+            
+            json_append_member(
+                node_object, 
+                "tileset",
+                json_mkbool(map->layers[i].objects[j].tileset)
+            );
+            json_append_member(
+                node_object, 
+                "auto_split",
+                json_mkbool(map->layers[i].objects[j].auto_split)
+            );
+            json_append_member(
+                node_object, 
+                "scale_mul",
+                json_mknumber(map->layers[i].objects[j].scale)
+            );
+            json_append_member(
+                node_object, 
+                "rotation_deg",
+                json_mknumber(map->layers[i].objects[j].rotation)
+            );
+            
+            if (object->solid_tiles != NULL)
+                json_append_member(
+                    node_object, 
+                    "solid_tiles", 
+                    SaveTileIdBits(object->solid_tiles, object->solid_tile_count)
+                );
+            
+            if (object->opaque_tiles != NULL)
+                json_append_member(
+                    node_object, 
+                    "opaque_tiles", 
+                    SaveTileIdBits(object->opaque_tiles, object->opaque_tile_count)
+                );
+            
+            if (object->animation_count > 0) {
+                node_animations = json_mkarray();
+                
+                for (int k = 0; k < object->animation_count; k++) {
+                    node_animation = json_mkobject();
+                    
+                    node_frames = json_mkarray();
+                    node_durations = json_mkarray();
+                    
+                    for (int l = 0; l < object->animations[k].frame_count; l++) {
+                        json_append_element(node_frames, json_mknumber(object->animations[k].frames[l]));
+                        json_append_element(node_durations, json_mknumber(object->animations[k].durations[l]));
+                    }
+                    
+                    json_append_member(node_animation, "id", json_mknumber(object->animations[k].tile_id));
+                    json_append_member(node_animation, "frames", node_frames);
+                    json_append_member(node_animation, "duration_ms", node_durations);
+                    
+                    json_append_element(node_animations, node_animation);
+                }
+                
+                json_append_member(node_object, "animations", node_animations);
+            }
+            
+            if (object->autotile_count > 0) {
+                node_autotiles = json_mkarray();
+                
+                for (int k = 0; k < object->autotile_count; k++) {
+                    node_autotile = json_mkobject();
+                    node_tiles = json_mkarray();
+                    
+                    for (int l = 0; l < object->autotiles[k].tile_count; l++)
+                        json_append_element(node_tiles, json_mknumber(object->autotiles[k].tiles[l]));
+                    
+                    json_append_member(node_autotile, "id", json_mknumber(object->autotiles[k].terrain_id));
+                    json_append_member(
+                        node_autotile, 
+                        "mode", 
+                        json_mkstring((object->autotiles[k].mode == LW_AUTOTILE_WANG16) ? "wang16" : "blob47")
+                    );
+                    json_append_member(node_autotile, "tiles", node_tiles);
+                    
+                    json_append_element(node_autotiles, node_autotile);
+                }
+                
+                json_append_member(node_object, "autotiles", node_autotiles);
+            }
+            
+            json_append_member(
+                node_object, 
+                "position",
+                node_position
+            );
+            json_append_member(
+                node_object,
+                "tiledata",
+                node_tiledata
+            );
+            
+            json_append_element(node_objects, node_object);
+        }
+        
+        json_append_member(node_layer, "id", json_mknumber(i));
+        json_append_member(node_layer, "static", json_mkbool(map->layers[i].is_static));
+        
+        if (!IsDefaultParallax(&map->layers[i])) {
+            node_parallax = json_mkobject();
+            
+            json_append_member(node_parallax, "x", json_mknumber(map->layers[i].parallax.x));
+            json_append_member(node_parallax, "y", json_mknumber(map->layers[i].parallax.y));
+            
+            json_append_member(node_layer, "parallax", node_parallax);
+        }
+        
+        json_append_member(node_layer, "objects", node_objects);
+        
+        json_append_element(node_layers, node_layer);
+    }
+    
+    json_append_member(node_root, "layers", node_layers);
+    
+    RL_FREE(chunk_buffer);
+    
+    return true;
+}
+
+/* 게임 맵 파일의 경로 `file_path`에 해당하는 저널 파일의 경로를 구한다. */
+static const char *GetJournalPath(const char *file_path) {
+    static char journal_path[MAX_STRING_LENGTH];
+    
+    snprintf(journal_path, MAX_STRING_LENGTH, "%s%s", file_path, LW_JOURNAL_SUFFIX);
+    
+    return journal_path;
+}
+
+/* 저널 파일의 한 줄에 해당하는 변경 사항 `node_record`를 게임 맵에 적용한다. */
+static void ApplyJournalRecord(LwMap *map, JsonNode *node_record) {
+    JsonNode *node_objects, *node_object;
+    JsonNode *node_chunks, *node_chunk;
+    JsonNode *node_member, *node_tiledata;
+    
+    LwObject *object;
+    LwChunk *chunk;
+    
+    int *chunk_data;
+    
+    int chunk_index, tile_index;
+    
+    node_objects = json_find_member(node_record, "objects");
+    node_chunks = json_find_member(node_record, "chunks");
+    
+    json_foreach(node_object, node_objects) {
+        node_member = json_find_member(node_object, "id");
+        
+        if (node_member == NULL 
+            || (object = GetObject(map, (int) node_member->number_)) == NULL)
+            continue;
+        
+        json_foreach(node_member, json_find_member(node_object, "position")) {
+            LwKey key = GetKeyType(node_member->key);
+            
+            if (key == LW_KEY_X)
+                object->position.x = node_member->number_;
+            else if (key == LW_KEY_Y)
+                object->position.y = node_member->number_;
+        }
+    }
+    
+    json_foreach(node_chunk, node_chunks) {
+        node_member = json_find_member(node_chunk, "object");
+        
+        if (node_member == NULL 
+            || (object = GetObject(map, (int) node_member->number_)) == NULL
+            || !object->tileset || object->auto_split)
+            continue;
+        
+        if (!object->loaded)
+            LoadObject(map, object);
+        
+        node_member = json_find_member(node_chunk, "index");
+        
+        if (node_member == NULL)
+            continue;
+        
+        chunk_index = (int) node_member->number_;
+        
+        if (chunk_index < 0 || chunk_index > object->chunkset.count - 1)
+            continue;
+        
+        chunk = &object->chunkset.chunks[chunk_index];
+        chunk_data = GetChunkData(map, object, chunk_index);
+        
+        /* 저널 파일의 값으로 청크를 덮어쓰므로, 라이브러리가 고른 자동 타일의 표시도 다시 만든다. */
+        if (chunk->_autotiled != NULL)
+            memset(chunk->_autotiled, 0, map->chunk_width * map->chunk_height * sizeof(bool));
+        
+        node_tiledata = json_find_member(node_chunk, "tiledata");
+        
+        if (node_tiledata != NULL && node_tiledata->tag == JSON_STRING) {
+            if (!DecodeTileDataString(node_tiledata->string_, chunk_data, map->chunk_width * map->chunk_height))
+                continue;
+        } else {
+            tile_index = 0;
+            
+            json_foreach(node_member, node_tiledata) {
+                if (tile_index > (map->chunk_width * map->chunk_height) - 1)
+                    break;
+                
+                chunk_data[tile_index++] = LW_MAX((int) node_member->number_, -1);
+            }
+        }
+        
+        for (int i = 0; i < (map->chunk_width * map->chunk_height) && !chunk->_valid; i++)
+            if (chunk_data[i] >= 0)
+                chunk->_valid = true;
+        
+        /* 저널 파일에는 지형의 고유 번호가 저장되므로, 청크와 그 경계에 맞닿은 타일을 다시 고른다. */
+        ResolveAutotileRect(
+            map, object, 
+            (GetMapChunkX(map, chunk_index) * map->chunk_width) - 1, 
+            (GetMapChunkY(map, chunk_index) * map->chunk_height) - 1, 
+            (GetMapChunkX(map, chunk_index) + 1) * map->chunk_width, 
+            (GetMapChunkY(map, chunk_index) + 1) * map->chunk_height, 
+            LW_DIRTY_RENDER | LW_DIRTY_LOD
+        );
+        
+        if (object->animation_count > 0)
+            UpdateAnimatedTiles(map, object, chunk_index, chunk_data);
+        
+        /* 
+            저널 파일에 이미 기록된 변경 사항이므로, 다시 저장할 필요는 없다. 
+            경로 탐색에 사용되는 출입구는 충돌 판정을 다시 계산할 때 모두 다시 계산된다.
+        */
+        MarkChunkDirty(map, object, chunk_index, LW_DIRTY_ALL & ~(LW_DIRTY_SAVE | LW_DIRTY_PATH));
+    }
+}
+
+/* 게임 맵 파일의 경로 `file_path`에 해당하는 저널 파일의 변경 사항을 모두 게임 맵에 적용한다. */
+static bool LoadMapJournal(LwMap *map, const char *file_path) {
+    JsonArena *arena;
+    JsonNode *node_record;
+    
+    char *journal_data, *line, *line_end;
+    
+    int record_count = 0;
+    
+    if (!FileExists(GetJournalPath(file_path)))
+        return true;
+    
+    if ((journal_data = LoadFileText(GetJournalPath(file_path))) == NULL)
+        return false;
+    
+    arena = json_arena_new();
+    
+    for (line = journal_data; *line != '\0'; line = line_end) {
+        if ((line_end = strchr(line, '\n')) != NULL)
+            *(line_end++) = '\0';
+        else
+            line_end = line + strlen(line);
+        
+        if (*line == '\0')
+            continue;
+        
+        /* 저장 도중에 프로그램이 종료되어 마지막 줄이 잘린 경우, 그 이전까지만 적용한다. */
+        if ((node_record = json_decode_arena(line, arena)) == NULL) {
+            TraceLog(
+                LOG_WARNING, 
+                "LOWEL: [MAP '%s'] Ignoring a corrupted journal record #%d",
+                map->name,
+                record_count
+            );
+            
+            break;
+        }
+        
+        ApplyJournalRecord(map, node_record);
+        
+        record_count++;
+    }
+    
+    json_arena_free(arena);
+    
+    RL_FREE(journal_data);
+    
+    if (record_count > 0) {
+        TraceLog(
+            LOG_INFO, 
+            "LOWEL: [MAP '%s'] Replayed %d journal record(s)",
+            map->name,
+            record_count
+        );
+        
+        BuildCollisionGrid(map);
+        RebuildLight(map);
+    }
+    
+    return true;
+}
+
+/* 
+    타일셋이 아닌 개체 `object`가 차지하는 범위를 반환한다. 텍스처를 불러오지 않았어도 이미지 크기로 
+    계산할 수 있다.
+*/
+static Rectangle GetObjectBounds(LwObject *object) {
+    double radius;
+    
+    /* 회전된 개체도 포함할 수 있도록, 개체의 대각선 길이를 기준으로 범위를 넉넉하게 잡는다. */
+    if (object->rotation != 0.0) {
+        radius = sqrt(
+            (object->image_width * object->image_width)
+            + (object->image_height * object->image_height)
+        ) * object->scale;
+        
+        return (Rectangle) {
+            object->position.x - radius,
+            object->position.y - radius,
+            2.0 * radius,
+            2.0 * radius
+        };
+    }
+    
+    return (Rectangle) {
+        object->position.x,
+        object->position.y,
+        object->image_width * object->scale,
+        object->image_height * object->scale
+    };
+}
+
+/* 두 사각형 `a`와 `b`가 겹치는지 확인한다. */
+static inline bool IsRectangleOverlapping(Rectangle a, Rectangle b) {
+    return (a.x < b.x + b.width) && (a.x + a.width > b.x)
+        && (a.y < b.y + b.height) && (a.y + a.height > b.y);
+}
+
+/* 
+    타일셋이 아닌 개체 `object`가 위치 `position`이 속한 청크에서 거리가 `map.draw_distance` 이하인 
+    청크들의 범위와 겹치는지 확인한다. 개체의 크기를 아직 알 수 없다면 `true`를 반환한다.
+*/
+static bool IsObjectInsideChunkWindow(LwMap *map, LwObject *object, Vector2 position) {
+    float chunk_width = map->chunk_width * map->tile_width;
+    float chunk_height = map->chunk_height * map->tile_height;
+    
+    Rectangle window_rec = {
+        (floorf(position.x / chunk_width) - map->draw_distance) * chunk_width,
+        (floorf(position.y / chunk_height) - map->draw_distance) * chunk_height,
+        ((2 * map->draw_distance) + 1) * chunk_width,
+        ((2 * map->draw_distance) + 1) * chunk_height
+    };
+    
+    if (object->image_width <= 0 || object->image_height <= 0)
+        return true;
+    
+    return IsRectangleOverlapping(GetObjectBounds(object), window_rec);
+}
+
+/* 개체 `object`가 게임 맵에서 고유 번호가 `index`인 청크와 겹치는지 확인한다. */
+static bool IsObjectInsideMapChunk(LwMap *map, LwObject *object, int index) {
+    Rectangle chunk_rec;
+    Vector2 chunk_position;
+    
+    chunk_position = ChunkIndexToPositionMap(map, index);
+    
+    chunk_rec = (Rectangle) {
+        chunk_position.x,
+        chunk_position.y,
+        map->chunk_width * map->tile_width,
+        map->chunk_height * map->tile_height
+    };
+    
+    if (object->tileset && !object->auto_split)
+        return object->chunkset.chunks[index]._valid;
+    
+    return IsRectangleOverlapping(GetObjectBounds(object), chunk_rec);
+}
+
+/* 
+    게임 맵 또는 개체 텍스처에서 고유 번호가 `index`인 청크를 그린다. `explored`가 `NULL`이 아니라면, 
+    비트 배열 `explored`에 표시된 타일만 그린다.
+*/
+static void DrawChunkTiles(LwMap *map, LwObject *object, int index, const uint32_t *explored) {
+    LwChunk *chunk;
+    Vector2 chunk_position;
+    
+    const uint8_t *light_levels = NULL;
+    
+    int *chunk_data;
+    
+    int tile_id, relative_tile_index = 0, animated_index = 0;
+    
+    if (index < 0 || !object->chunkset.chunks[index]._valid)
+        return;
+    
+    chunk = &object->chunkset.chunks[index];
+    chunk_data = GetChunkData(map, object, index);
+    
+    chunk_position = (object->tileset && !object->auto_split)
+        ? ChunkIndexToPositionMap(map, index)
+        : ChunkIndexToPositionObject(map, object, index);
+    
+    /* 밝기는 청크 단위로 저장되어 있으므로, 게임 맵에 맞춰 그려지는 청크는 타일 데이터와 같은 순서로 읽는다. */
+    if (map->_light != NULL && object->tileset && !object->auto_split)
+        light_levels = &map->_light->levels[index * map->chunk_width * map->chunk_height];
+    
+    /* 타일마다 청크 안에서의 위치를 다시 나누어 구하지 않도록, 행과 열을 따라 순서대로 그린다. */
+    for (int tile_y = 0; tile_y < map->chunk_height; tile_y++) {
+        for (int tile_x = 0; tile_x < map->chunk_width; tile_x++, relative_tile_index++) {
+            if ((tile_id = chunk_data[relative_tile_index]) < 0)
+                continue;
+            
+            /* 애니메이션이 있는 타일의 목록은 정렬되어 있으므로, 타일마다 따로 찾지 않고 함께 따라간다. */
+            if (animated_index < chunk->animated_tile_count 
+                && chunk->animated_tiles[animated_index] == relative_tile_index) {
+                tile_id = GetAnimatedTileId(object, tile_id);
+                
+                animated_index++;
+            }
+            
+            if (explored != NULL && !IsBitSet(explored, relative_tile_index))
+                continue;
+            
+            DrawTextureRec(
+                object->texture,
+                GetTileSourceRec(map, object, tile_id),
+                (Vector2) {
+                    chunk_position.x + (tile_x * map->tile_width),
+                    chunk_position.y + (tile_y * map->tile_height)
+                },
+                (light_levels != NULL) ? GetLightTint(map, light_levels[relative_tile_index]) : WHITE
+            );
+        }
+    }
+}
+
+/* 
+    `first_layer`번째 레이어부터 `last_layer`번째 레이어까지의 정적 레이어를 
+    고유 번호가 `index`인 청크의 렌더 텍스처에 합성한다.
+*/
+static void BakeStaticChunk(LwMap *map, int first_layer, int last_layer, int index) {
+    LwBakedChunk *baked_chunk;
+    LwObject *object;
+    
+    bool has_content = false;
+    
+    for (int i = first_layer; i <= last_layer && !has_content; i++) {
+        if (!map->layers[i]._valid || !map->layers[i].is_static)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0 && !has_content; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid || !object->texture.id)
+                continue;
+            
+            has_content = IsObjectInsideMapChunk(map, object, index);
+        }
+    }
+    
+    baked_chunk = &map->layers[first_layer]._baked[index];
+    
+    if (!has_content) {
+        if (baked_chunk->_valid) {
+            UnloadRenderTexture(baked_chunk->target);
+            
+            baked_chunk->_valid = false;
+        }
+        
+        return;
+    }
+    
+    if (!baked_chunk->_valid) {
+        baked_chunk->target = LoadRenderTexture(
+            map->chunk_width * map->tile_width,
+            map->chunk_height * map->tile_height
+        );
+        
+        baked_chunk->_valid = true;
+    }
+    
+    BeginTextureMode(baked_chunk->target);
+    
+    ClearBackground(BLANK);
+    
+    BeginMode2D((Camera2D) {
+        .target = ChunkIndexToPositionMap(map, index),
+        .zoom = 1.0f
+    });
+    
+    for (int i = first_layer; i <= last_layer; i++) {
+        if (!map->layers[i]._valid || !map->layers[i].is_static)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid || !object->texture.id
+                || !IsObjectInsideMapChunk(map, object, index))
+                continue;
+            
+            if (object->tileset && !object->auto_split) {
+                DrawChunkTiles(map, object, index, NULL);
+            } else if (!object->tileset && object->auto_split) {
+                for (int k = 0; k < (object->width.c * object->height.c); k++)
+                    DrawChunkTiles(map, object, k, NULL);
+            } else {
+                DrawTextureEx(
+                    object->texture,
+                    object->position,
+                    object->rotation,
+                    object->scale,
+                    WHITE
+                );
+            }
+        }
+    }
+    
+    EndMode2D();
+    
+    EndTextureMode();
+}
+
+/* `first_layer`번째 레이어부터 시작하는 정적 레이어 묶음의 마지막 레이어 번호를 구한다. */
+static int GetStaticLayerRunEnd(LwMap *map, int first_layer) {
+    int last_layer = first_layer;
+    
+    for (int i = first_layer + 1; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        if (!map->layers[i]._merged)
+            break;
+        
+        last_layer = i;
+    }
+    
+    return last_layer;
+}
+
+/* 
+    연속된 정적 레이어들을 청크 단위로 미리 합성한다. 각 묶음의 첫 번째 레이어에 합성 결과가 
+    저장되며, 나머지 레이어는 게임 맵을 그릴 때 건너뛴다.
+*/
+static void BakeStaticLayers(LwMap *map) {
+    int first_layer = -1, last_layer = -1;
+    
+    for (int i = 0; i <= MAX_LAYER_COUNT; i++) {
+        if (i < MAX_LAYER_COUNT && !map->layers[i]._valid)
+            continue;
+        
+        /* 스크롤 비율이 다른 정적 레이어는 서로 다른 위치에 그려지므로, 같은 묶음으로 합성하지 않는다. */
+        if (first_layer >= 0 
+            && (i == MAX_LAYER_COUNT || !map->layers[i].is_static
+                || map->layers[i].parallax.x != map->layers[first_layer].parallax.x
+                || map->layers[i].parallax.y != map->layers[first_layer].parallax.y)) {
+            map->layers[first_layer]._baked = (LwBakedChunk *) RL_CALLOC(
+                map->width.c * map->height.c,
+                sizeof(LwBakedChunk)
+            );
+            
+            for (int j = 0; j < (map->width.c * map->height.c); j++)
+                BakeStaticChunk(map, first_layer, last_layer, j);
+            
+            TraceLog(
+                LOG_INFO, 
+                "LOWEL: [MAP '%s'] Baked static layers #%d to #%d",
+                map->name,
+                first_layer,
+                last_layer
+            );
+            
+            first_layer = last_layer = -1;
+        }
+        
+        if (i < MAX_LAYER_COUNT && map->layers[i].is_static) {
+            /* 정적 레이어는 미리 합성해야 하므로, 개체를 모두 불러온다. */
+            for (int j = map->layers[i]._first_object; 
+                 j >= 0; 
+                 j = map->layers[i].objects[j]._next)
+                LoadObject(map, &map->layers[i].objects[j]);
+            
+            if (first_layer < 0) {
+                first_layer = i;
+            } else {
+                map->layers[i]._merged = true;
+            }
+            
+            last_layer = i;
+        }
+    }
+}
+
+/* 정적 레이어 묶음에서 고유 번호가 `index`인 청크와 겹치는 개체가 모두 타일셋 개체인지 확인한다. */
+static bool IsBakedChunkTileOnly(LwMap *map, int first_layer, int last_layer, int index) {
+    LwObject *object;
+    
+    for (int i = first_layer; i <= last_layer; i++) {
+        if (!map->layers[i]._valid || !map->layers[i].is_static)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid || !object->texture.id || (object->tileset && !object->auto_split))
+                continue;
+            
+            if (IsObjectInsideMapChunk(map, object, index))
+                return false;
+        }
+    }
+    
+    return true;
+}
+
+/* 
+    `first_layer`번째 레이어부터 `last_layer`번째 레이어까지를 미리 합성한, 고유 번호가 `index`인 
+    청크에서 개체 `object`의 애니메이션 프레임이 바뀐 타일만 다시 그린다. 청크와 겹치는 개체 중에 
+    타일셋 개체가 아닌 개체가 있다면, 타일 단위로 다시 그릴 수 없으므로 청크 전체를 다시 합성한다.
+*/
+static void PatchBakedAnimatedTiles(
+    LwMap *map, 
+    int first_layer, int last_layer, 
+    LwObject *object, int index
+) {
+    LwBakedChunk *baked_chunk = &map->layers[first_layer]._baked[index];
+    LwChunk *chunk = &object->chunkset.chunks[index];
+    LwObject *other;
+    
+    const uint8_t *light_levels = NULL;
+    
+    const int *chunk_data;
+    
+    bool patching = false;
+    
+    int relative_tile_index, tile_id, tile_x, tile_y;
+    
+    if (!baked_chunk->_valid)
+        return;
+    
+    chunk_data = GetChunkData(map, object, index);
+    
+    /* 합성할 때와 같은 밝기로 다시 그려야 하므로, 청크의 밝기를 함께 읽는다. */
+    if (map->_light != NULL)
+        light_levels = &map->_light->levels[index * map->chunk_width * map->chunk_height];
+    
+    for (int i = 0; i < chunk->animated_tile_count; i++) {
+        relative_tile_index = chunk->animated_tiles[i];
+        
+        tile_id = chunk_data[relative_tile_index];
+        
+        if (!IsAnimatedTileId(object, tile_id) 
+            || !object->animations[object->animation_lookup[tile_id]].changed)
+            continue;
+        
+        if (!patching) {
+            if (!IsBakedChunkTileOnly(map, first_layer, last_layer, index)) {
+                BakeStaticChunk(map, first_layer, last_layer, index);
+                
+                return;
+            }
+            
+            BeginTextureMode(baked_chunk->target);
+            
+            BeginMode2D((Camera2D) {
+                .target = ChunkIndexToPositionMap(map, index),
+                .zoom = 1.0f
+            });
+            
+            patching = true;
+        }
+        
+        tile_x = relative_tile_index % map->chunk_width;
+        tile_y = relative_tile_index / map->chunk_width;
+        
+        /* 타일 하나의 영역만 지운 다음, 그 위치에 있는 모든 정적 레이어의 타일을 순서대로 다시 그린다. */
+        BeginScissorMode(
+            tile_x * map->tile_width, 
+            tile_y * map->tile_height, 
+            map->tile_width, 
+            map->tile_height
+        );
+        
+        ClearBackground(BLANK);
+        
+        for (int j = first_layer; j <= last_layer; j++) {
+            if (!map->layers[j]._valid || !map->layers[j].is_static)
+                continue;
+            
+            for (int k = map->layers[j]._first_object; k >= 0; k = map->layers[j].objects[k]._next) {
+                other = &map->layers[j].objects[k];
+                
+                if (!other->_valid || !other->texture.id || !other->tileset || other->auto_split
+                    || other->chunkset.chunks == NULL || !other->chunkset.chunks[index]._valid)
+                    continue;
+                
+                if ((tile_id = GetChunkData(map, other, index)[relative_tile_index]) < 0)
+                    continue;
+                
+                DrawTextureRec(
+                    other->texture,
+                    GetTileSourceRec(map, other, GetAnimatedTileId(other, tile_id)),
+                    (Vector2) {
+                        ChunkIndexToPositionMap(map, index).x + (tile_x * map->tile_width),
+                        ChunkIndexToPositionMap(map, index).y + (tile_y * map->tile_height)
+                    },
+                    (light_levels != NULL) ? GetLightTint(map, light_levels[relative_tile_index]) : WHITE
+                );
+            }
+        }
+        
+        EndScissorMode();
+    }
+    
+    if (patching) {
+        EndMode2D();
+        
+        EndTextureMode();
+    }
+}
+
+/* 
+    미리 합성된 정적 레이어의 청크 `baked_chunk`에서, 본 적이 있는 타일만 행마다 연속된 구간으로 
+    나누어 그린다.
+*/
+static void DrawBakedChunkExplored(LwMap *map, LwBakedChunk *baked_chunk, int index) {
+    const uint32_t *explored = &map->_fog->explored[index * map->_fog->chunk_words];
+    
+    Vector2 chunk_position = ChunkIndexToPositionMap(map, index);
+    
+    int relative_tile_index, span_start;
+    
+    for (int tile_y = 0; tile_y < map->chunk_height; tile_y++) {
+        relative_tile_index = tile_y * map->chunk_width;
+        
+        for (int tile_x = 0; tile_x < map->chunk_width; tile_x++) {
+            if (!IsBitSet(explored, relative_tile_index + tile_x))
+                continue;
+            
+            span_start = tile_x;
+            
+            while (tile_x + 1 < map->chunk_width && IsBitSet(explored, relative_tile_index + tile_x + 1))
+                tile_x++;
+            
+            /* 렌더 텍스처는 위아래가 뒤집힌 상태로 저장되므로, 아래쪽부터 세어서 잘라낸다. */
+            DrawTextureRec(
+                baked_chunk->target.texture,
+                (Rectangle) {
+                    span_start * map->tile_width,
+                    (map->chunk_height - tile_y - 1) * map->tile_height,
+                    (tile_x - span_start + 1) * map->tile_width,
+                    -map->tile_height
+                },
+                (Vector2) {
+                    chunk_position.x + (span_start * map->tile_width),
+                    chunk_position.y + (tile_y * map->tile_height)
+                },
+                WHITE
+            );
+        }
+    }
+}
+
+/* 위치 `position`의 주변에 있는, 미리 합성된 정적 레이어의 청크를 모두 그린다. */
+static void DrawBakedChunks(LwMap *map, LwLayer *layer, Vector2 position) {
+    LwBakedChunk *baked_chunk;
+    
+    int chunk_index, index, explored_count;
+    int adjacent_chunk_x, adjacent_chunk_y;
+    
+    if ((chunk_index = PositionToChunkIndexMap(map, position)) < 0)
+        return;
+    
+    for (int dy = -(map->draw_distance); dy <= map->draw_distance; dy++) {
+        for (int dx = -(map->draw_distance); dx <= map->draw_distance; dx++) {
+            adjacent_chunk_x = GetMapChunkX(map, chunk_index) + dx;
+            adjacent_chunk_y = GetMapChunkY(map, chunk_index) + dy;
+            
+            if (adjacent_chunk_x < 0 || adjacent_chunk_x > map->width.c - 1
+               || adjacent_chunk_y < 0 || adjacent_chunk_y > map->height.c - 1)
+                continue;
+            
+            index = (adjacent_chunk_y * map->width.c) + adjacent_chunk_x;
+            
+            baked_chunk = &layer->_baked[index];
+            
+            if (!baked_chunk->_valid || (explored_count = GetExploredTileCount(map, index)) == 0)
+                continue;
+            
+            if (explored_count < map->chunk_width * map->chunk_height) {
+                DrawBakedChunkExplored(map, baked_chunk, index);
+                
+                continue;
+            }
+            
+            /* 렌더 텍스처는 위아래가 뒤집힌 상태로 저장되므로, 세로 길이를 음수로 지정한다. */
+            DrawTextureRec(
+                baked_chunk->target.texture,
+                (Rectangle) {
+                    0,
+                    0,
+                    baked_chunk->target.texture.width,
+                    -baked_chunk->target.texture.height
+                },
+                ChunkIndexToPositionMap(map, index),
+                WHITE
+            );
+        }
+    }
+}
+
+/* 
+    개체 `object`가 레이어 `layer`의 축소 이미지에 미리 그려두는 개체인지 확인한다. 미리 합성된 
+    정적 레이어 묶음은 모든 개체를, 그 외의 레이어는 타일셋 개체만 축소 이미지에 그린다.
+*/
+static inline bool IsLodObject(LwLayer *layer, LwObject *object) {
+    return object->_valid && (layer->_baked != NULL || (object->tileset && !object->auto_split));
+}
+
+/* 고유 번호가 `layer_id`인 레이어의 축소 이미지가 저장되는, 정적 레이어 묶음의 첫 번째 레이어 번호를 구한다. */
+static int GetLodLayerId(LwMap *map, int layer_id) {
+    while (layer_id > 0 && map->layers[layer_id]._merged) {
+        layer_id--;
+        
+        while (layer_id > 0 && !map->layers[layer_id]._valid)
+            layer_id--;
+    }
+    
+    return layer_id;
+}
+
+/* 고유 번호가 `layer_id`인 레이어와 함께 축소 이미지에 그려지는 마지막 레이어 번호를 구한다. */
+static inline int GetLodLayerEnd(LwMap *map, int layer_id) {
+    return (map->layers[layer_id]._baked != NULL) 
+        ? GetStaticLayerRunEnd(map, layer_id) 
+        : layer_id;
+}
+
+/* 게임 맵 전체가 하나의 청크 묶음이 되는, 축소 이미지의 마지막 단계를 구한다. */
+static int GetMaxLodLevel(LwMap *map) {
+    int max_level = 1;
+    
+    while ((1 << max_level) < LW_MAX(map->width.c, map->height.c))
+        max_level++;
+    
+    return max_level;
+}
+
+/* 화면에 그려지는 타일의 크기를 기준으로, 확대 배율이 `zoom`일 때 그릴 축소 이미지의 단계를 구한다. */
+static int GetLodLevel(LwMap *map, float zoom) {
+    int level = 1, max_level;
+    
+    if (zoom <= 0.0f || zoom >= 1.0f 
+        || LW_MIN(map->tile_width, map->tile_height) * zoom >= LOD_TILE_SIZE)
+        return 0;
+    
+    max_level = GetMaxLodLevel(map);
+    
+    /* 축소 이미지의 해상도가 화면보다 낮아지지 않는 가장 작은 이미지를 고른다. */
+    while (level < max_level && zoom * (1 << (level + 1)) <= 1.0f)
+        level++;
+    
+    return level;
+}
+
+/* 고유 번호가 `layer_id`인 레이어에서 `level`번째 단계의 축소 이미지 배열을 반환한다. */
+static LwLodLevel *GetLayerLodLevel(LwMap *map, int layer_id, int level) {
+    LwLayer *layer = &map->layers[layer_id];
+    LwLodLevel *lod_level;
+    
+    if (layer->_lod == NULL) {
+        layer->_lod_count = GetMaxLodLevel(map);
+        
+        layer->_lod = (LwLodLevel *) RL_CALLOC(layer->_lod_count, sizeof(LwLodLevel));
+        
+        for (int i = 0; i < layer->_lod_count; i++) {
+            layer->_lod[i] = (LwLodLevel) {
+                .width = (map->width.c + (1 << (i + 1)) - 1) >> (i + 1),
+                .height = (map->height.c + (1 << (i + 1)) - 1) >> (i + 1)
+            };
+        }
+    }
+    
+    lod_level = &layer->_lod[level - 1];
+    
+    if (lod_level->images == NULL)
+        lod_level->images = (LwLodImage *) RL_CALLOC(
+            lod_level->width * lod_level->height,
+            sizeof(LwLodImage)
+        );
+    
+    return lod_level;
+}
+
+/* 
+    고유 번호가 `layer_id`인 레이어 묶음에서 `LW_DIRTY_LOD`가 표시된 청크를 포함하는 축소 이미지를 
+    모두 다시 만들도록 표시한 다음, 변경 사항 표시를 지운다.
+*/
+static void InvalidateLayerLod(LwMap *map, int layer_id) {
+    LwLayer *layer = &map->layers[layer_id];
+    LwObject *object;
+    LwLodLevel *lod_level;
+    
+    int chunk_index, chunk_x, chunk_y;
+    
+    for (int i = layer_id; i <= GetLodLayerEnd(map, layer_id); i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid || !object->tileset || object->auto_split 
+                || object->chunkset.chunks == NULL)
+                continue;
+            
+            for (int k = 0; k < object->chunkset.dirty_count; k++) {
+                chunk_index = object->chunkset.dirty_indexes[k];
+                
+                if (!(object->chunkset.chunks[chunk_index].dirty & LW_DIRTY_LOD))
+                    continue;
+                
+                chunk_x = GetMapChunkX(map, chunk_index);
+                chunk_y = GetMapChunkY(map, chunk_index);
+                
+                for (int level = 1; level <= layer->_lod_count; level++) {
+                    lod_level = &layer->_lod[level - 1];
+                    
+                    if (lod_level->images != NULL)
+                        lod_level->images[((chunk_y >> level) * lod_level->width) 
+                            + (chunk_x >> level)]._valid = false;
+                }
+            }
+            
+            ClearDirtyChunks(object, LW_DIRTY_LOD);
+        }
+    }
+}
+
+/* 고유 번호가 `layer_id`인 레이어의 축소 이미지를 모두 다시 만들도록 표시한다. */
+static void ResetLayerLod(LwMap *map, int layer_id) {
+    LwLayer *layer = &map->layers[GetLodLayerId(map, layer_id)];
+    LwLodLevel *lod_level;
+    
+    for (int i = 0; i < layer->_lod_count; i++) {
+        lod_level = &layer->_lod[i];
+        
+        for (int j = 0; lod_level->images != NULL && j < (lod_level->width * lod_level->height); j++)
+            lod_level->images[j]._valid = false;
+    }
+}
+
+/* 
+    고유 번호가 `layer_id`인 레이어에서, `level`번째 단계의 청크 묶음 `(group_x, group_y)`에 해당하는 
+    축소 이미지를 만들고, 그릴 내용이 있다면 `true`를 반환한다. 첫 번째 단계의 이미지는 타일 데이터로부터, 
+    그 다음 단계의 이미지는 이전 단계의 이미지 4개로부터 만든다.
+*/
+static bool BuildLodImage(LwMap *map, int layer_id, int level, int group_x, int group_y) {
+    LwLodLevel *lod_level = GetLayerLodLevel(map, layer_id, level), *child_level;
+    LwLodImage *image = &lod_level->images[(group_y * lod_level->width) + group_x], *child;
+    LwObject *object;
+    
+    Rectangle group_rec;
+    
+    int chunk_x, chunk_y;
+    int image_width, image_height;
+    
+    bool has_content = false, inside;
+    
+    if (image->_valid)
+        return image->target.id != 0;
+    
+    image->_valid = true;
+    
+    image_width = map->chunk_width * map->tile_width;
+    image_height = map->chunk_height * map->tile_height;
+    
+    /* 렌더 텍스처 안에서 다른 렌더 텍스처에 그릴 수는 없으므로, 이전 단계의 이미지를 먼저 만든다. */
+    if (level > 1) {
+        child_level = GetLayerLodLevel(map, layer_id, level - 1);
+        
+        for (int dy = 0; dy < 2; dy++) {
+            for (int dx = 0; dx < 2; dx++) {
+                if ((group_x << 1) + dx < child_level->width && (group_y << 1) + dy < child_level->height
+                    && BuildLodImage(map, layer_id, level - 1, (group_x << 1) + dx, (group_y << 1) + dy))
+                    has_content = true;
+            }
+        }
+    } else {
+        for (int i = layer_id; i <= GetLodLayerEnd(map, layer_id); i++) {
+            if (!map->layers[i]._valid)
+                continue;
+            
+            for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+                object = &map->layers[i].objects[j];
+                
+                if (!IsLodObject(&map->layers[layer_id], object))
+                    continue;
+                
+                LoadObject(map, object);
+                
+                if (!object->texture.id)
+                    continue;
+                
+                for (int k = 0; k < 4 && !has_content; k++) {
+                    chunk_x = (group_x << 1) + (k & 1);
+                    chunk_y = (group_y << 1) + (k >> 1);
+                    
+                    if (chunk_x < map->width.c && chunk_y < map->height.c)
+                        has_content = IsObjectInsideMapChunk(
+                            map, object, 
+                            (chunk_y * map->width.c) + chunk_x
+                        );
+                }
+            }
+        }
+    }
+    
+    if (!has_content) {
+        if (image->target.id) {
+            UnloadRenderTexture(image->target);
+            
+            image->target = (RenderTexture2D) { 0 };
+        }
+        
+        return false;
+    }
+    
+    if (!image->target.id) {
+        image->target = LoadRenderTexture(image_width, image_height);
+        
+        /* 다음 단계의 이미지를 만들 때 주변 픽셀의 평균으로 축소되도록, 선형 보간을 사용한다. */
+        SetTextureFilter(image->target.texture, TEXTURE_FILTER_BILINEAR);
+    }
+    
+    BeginTextureMode(image->target);
+    
+    ClearBackground(BLANK);
+    
+    if (level > 1) {
+        child_level = &map->layers[layer_id]._lod[level - 2];
+        
+        for (int dy = 0; dy < 2; dy++) {
+            for (int dx = 0; dx < 2; dx++) {
+                if ((group_x << 1) + dx >= child_level->width || (group_y << 1) + dy >= child_level->height)
+                    continue;
+                
+                child = &child_level->images[(((group_y << 1) + dy) * child_level->width) 
+                    + (group_x << 1) + dx];
+                
+                if (!child->target.id)
+                    continue;
+                
+                /* 렌더 텍스처는 위아래가 뒤집힌 상태로 저장되므로, 세로 길이를 음수로 지정한다. */
+                DrawTexturePro(
+                    child->target.texture,
+                    (Rectangle) { 0, 0, image_width, -image_height },
+                    (Rectangle) { 
+                        dx * (image_width >> 1), 
+                        dy * (image_height >> 1), 
+                        image_width >> 1, 
+                        image_height >> 1 
+                    },
+                    (Vector2) { 0.0f, 0.0f },
+                    0.0f,
+                    WHITE
+                );
+            }
+        }
+    } else {
+        group_rec = (Rectangle) { 
+            (group_x << 1) * image_width, 
+            (group_y << 1) * image_height, 
+            image_width << 1, 
+            image_height << 1 
+        };
+        
+        BeginMode2D((Camera2D) {
+            .target = (Vector2) { group_rec.x, group_rec.y },
+            .zoom = 0.5f
+        });
+        
+        for (int i = layer_id; i <= GetLodLayerEnd(map, layer_id); i++) {
+            if (!map->layers[i]._valid)
+                continue;
+            
+            for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+                object = &map->layers[i].objects[j];
+                
+                if (!IsLodObject(&map->layers[layer_id], object) || !object->texture.id)
+                    continue;
+                
+                if (object->tileset && !object->auto_split) {
+                    for (int k = 0; k < 4; k++) {
+                        chunk_x = (group_x << 1) + (k & 1);
+                        chunk_y = (group_y << 1) + (k >> 1);
+                        
+                        if (chunk_x < map->width.c && chunk_y < map->height.c)
+                            DrawChunkTiles(map, object, (chunk_y * map->width.c) + chunk_x, NULL);
+                    }
+                    
+                    continue;
+                }
+                
+                /* 청크 묶음과 겹치는 개체는 한 번만 그린다. */
+                inside = false;
+                
+                for (int k = 0; k < 4 && !inside; k++) {
+                    chunk_x = (group_x << 1) + (k & 1);
+                    chunk_y = (group_y << 1) + (k >> 1);
+                    
+                    inside = chunk_x < map->width.c && chunk_y < map->height.c
+                        && IsObjectInsideMapChunk(map, object, (chunk_y * map->width.c) + chunk_x);
+                }
+                
+                if (!inside)
+                    continue;
+                
+                if (!object->tileset && object->auto_split) {
+                    for (int k = 0; k < (object->width.c * object->height.c); k++)
+                        DrawChunkTiles(map, object, k, NULL);
+                } else {
+                    DrawTextureEx(
+                        object->texture,
+                        object->position,
+                        object->rotation,
+                        object->scale,
+                        WHITE
+                    );
+                }
+            }
+        }
+        
+        EndMode2D();
+    }
+    
+    EndTextureMode();
+    
+    return true;
+}
+
+/* 
+    레이어 기준 위치 `position`을 중심으로, 확대 배율이 `zoom`인 화면에 보이는 `level`번째 단계의 
+    청크 묶음 범위를 구한다.
+*/
+static void GetLodGroupRange(
+    LwMap *map, 
+    LwLodLevel *lod_level, int level, 
+    Vector2 position, float zoom, 
+    int *min_x, int *min_y, int *max_x, int *max_y
+) {
+    float half_width = (GetScreenWidth() * 0.5f) / zoom;
+    float half_height = (GetScreenHeight() * 0.5f) / zoom;
+    
+    float group_width = (float) ((map->chunk_width * map->tile_width) << level);
+    float group_height = (float) ((map->chunk_height * map->tile_height) << level);
+    
+    *min_x = LW_MAX((int) floorf((position.x - half_width) / group_width), 0);
+    *min_y = LW_MAX((int) floorf((position.y - half_height) / group_height), 0);
+    
+    *max_x = LW_MIN((int) floorf((position.x + half_width) / group_width), lod_level->width - 1);
+    *max_y = LW_MIN((int) floorf((position.y + half_height) / group_height), lod_level->height - 1);
+}
+
+/* 
+    `level`번째 단계의 청크 묶음 `(group_x, group_y)`에 본 적이 있는 청크가 하나라도 있는지 확인한다. 
+    전장의 안개가 없다면 항상 `true`를 반환한다.
+*/
+static bool IsLodGroupExplored(LwMap *map, int level, int group_x, int group_y) {
+    if (map->_fog == NULL)
+        return true;
+    
+    for (int chunk_y = group_y << level; chunk_y < LW_MIN((group_y + 1) << level, map->height.c); chunk_y++)
+        for (int chunk_x = group_x << level; chunk_x < LW_MIN((group_x + 1) << level, map->width.c); chunk_x++)
+            if (map->_fog->explored_counts[(chunk_y * map->width.c) + chunk_x] > 0)
+                return true;
+    
+    return false;
+}
+
+/* 
+    레이어 기준 위치 `position`을 중심으로, 확대 배율이 `zoom`인 화면에 보이는 `level`번째 단계의 
+    축소 이미지를 모두 그린다. 아직 만들지 않은 이미지는 그리지 않는다.
+*/
+static void DrawLodImages(LwMap *map, int layer_id, int level, Vector2 position, float zoom) {
+    LwLodLevel *lod_level = GetLayerLodLevel(map, layer_id, level);
+    LwLodImage *image;
+    
+    int min_x, min_y, max_x, max_y;
+    int image_width, image_height;
+    
+    image_width = map->chunk_width * map->tile_width;
+    image_height = map->chunk_height * map->tile_height;
+    
+    GetLodGroupRange(map, lod_level, level, position, zoom, &min_x, &min_y, &max_x, &max_y);
+    
+    for (int group_y = min_y; group_y <= max_y; group_y++) {
+        for (int group_x = min_x; group_x <= max_x; group_x++) {
+            image = &lod_level->images[(group_y * lod_level->width) + group_x];
+            
+            if (!image->target.id || !IsLodGroupExplored(map, level, group_x, group_y))
+                continue;
+            
+            DrawTexturePro(
+                image->target.texture,
+                (Rectangle) { 0, 0, image_width, -image_height },
+                (Rectangle) { 
+                    (float) (group_x * image_width) * (1 << level), 
+                    (float) (group_y * image_height) * (1 << level), 
+                    (float) (image_width << level), 
+                    (float) (image_height << level) 
+                },
+                (Vector2) { 0.0f, 0.0f },
+                0.0f,
+                WHITE
+            );
+        }
+    }
+}
+
+/* 
+    위치 `position`을 기준으로, 확대 배율이 `zoom`인 화면에 게임 맵의 고유 번호가 `layer_id`인 레이어를 
+    그린다. 그릴 청크는 레이어의 스크롤 비율로 환산된 위치를 기준으로 고르며, 그 차이만큼 레이어를 
+    옮겨서 그린다. 타일이 충분히 작게 그려진다면, 타일 대신 축소 이미지를 그린다.
+*/
+static void DrawMapLayer(LwMap *map, int layer_id, Vector2 position, float zoom) {
+    LwLayer *layer = &map->layers[layer_id];
+    LwObject *object;
+    
+    Vector2 layer_position;
+    
+    bool parallax;
+    
+    int level;
+    
+    if (!layer->_valid || layer->_merged)
+        return;
+    
+    if ((parallax = !IsDefaultParallax(layer))) {
+        layer_position = GetLayerPosition(layer, position);
+        
+        rlPushMatrix();
+        
+        rlTranslatef(position.x - layer_position.x, position.y - layer_position.y, 0.0f);
+    } else {
+        layer_position = position;
+    }
+    
+    if ((level = GetLodLevel(map, zoom)) > 0)
+        DrawLodImages(map, layer_id, level, layer_position, zoom);
+    
+    if (layer->_baked != NULL) {
+        if (level == 0)
+            DrawBakedChunks(map, layer, layer_position);
+    } else {
+        for (int j = layer->_first_object; j >= 0; j = layer->objects[j]._next) {
+            object = &layer->objects[j];
+            
+            /* 타일셋 개체는 레이어 전체에 걸쳐 있으므로 바로 불러오고, 나머지는 그릴 범위에 들어올 때 불러온다. */
+            if (object->_valid && !object->loaded 
+                && (object->tileset || IsObjectInsideChunkWindow(map, object, layer_position)))
+                LoadObject(map, object);
+            
+            if (!object->_valid || !object->texture.id)
+                continue;
+            
+            if (object->tileset && !object->auto_split) {
+                if (level == 0)
+                    LoadChunks(map, object, layer_position);
+            } else if (!object->tileset && object->auto_split && level == 0) {
+                LoadChunks(map, object, layer_position);
+            } else {
+                DrawTextureEx(
+                    object->texture,
+                    object->position,
+                    object->rotation,
+                    object->scale,
+                    WHITE
+                );
+            }
+        }
+    }
+    
+    if (parallax)
+        rlPopMatrix();
+}
+
+/* 월드를 구성하는 격자의 한 칸에 있는 게임 맵 데이터를 불러온다. 텍스처는 불러오지 않는다. */
+static bool ReadWorldCellData(LwWorldCell *cell) {
+    LwObject *object;
+    
+    char *map_data;
+    
+    bool result;
+    
+    cell->map = (LwMap) { .lazy_load = true };
+    
+    if ((map_data = (char *) LoadFileText(cell->path)) == NULL)
+        return false;
+    
+    result = LoadMapFromMemory(&cell->map, map_data);
+    
+    RL_FREE(map_data);
+    
+    if (!result)
+        return false;
+    
+    /* 타일셋 개체의 타일 데이터는 텍스처 없이도 불러올 수 있으므로, 미리 불러온다. */
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!cell->map.layers[i]._valid)
+            continue;
+        
+        for (int j = cell->map.layers[i]._first_object; 
+             j >= 0; 
+             j = cell->map.layers[i].objects[j]._next) {
+            object = &cell->map.layers[i].objects[j];
+            
+            if (object->_valid && object->tileset && !object->auto_split)
+                LoadObjectTileData(&cell->map, object);
+        }
+    }
+    
+    return true;
+}
+
+#ifndef LOWEL_NO_THREADS
+/* 백그라운드에서 게임 맵 데이터를 불러오는 스레드의 진입점이다. */
+static void *ReadWorldCellDataThread(void *data) {
+    LwWorldCell *cell = (LwWorldCell *) data;
+    
+    bool result = ReadWorldCellData(cell);
+    
+    pthread_mutex_lock(&cell->lock);
+    
+    cell->result = result;
+    cell->done = true;
+    
+    pthread_mutex_unlock(&cell->lock);
+    
+    return NULL;
+}
+#endif
+
+/* 월드를 구성하는 격자의 한 칸에 있는 게임 맵 데이터의 메모리를 해제한다. */
+static void UnloadWorldCellData(LwWorldCell *cell) {
+    if (cell->map.layers != NULL) {
+        UnloadMap(&cell->map);
+    } else {
+        RL_FREE(cell->map.name);
+        RL_FREE(cell->map._source);
+    }
+    
+    cell->map = (LwMap) { 0 };
+}
+
+/* 월드를 구성하는 격자의 한 칸에 있는 게임 맵 데이터를 백그라운드에서 불러오기 시작한다. */
+static void BeginWorldCellLoad(LwWorldCell *cell) {
+    cell->state = LW_WORLD_CELL_LOADING;
+    cell->done = false;
+    
+#ifndef LOWEL_NO_THREADS
+    cell->threaded = (pthread_create(&cell->thread, NULL, ReadWorldCellDataThread, cell) == 0);
+    
+    if (cell->threaded)
+        return;
+#endif
+    
+    /* 스레드를 사용할 수 없다면, 바로 불러온다. */
+    cell->result = ReadWorldCellData(cell);
+    cell->done = true;
+}
+
+/* 백그라운드에서 게임 맵 데이터를 모두 불러온 다음, 텍스처를 불러오는 등의 남은 작업을 처리한다. */
+static void FinishWorldCellLoad(LwWorld *world, LwWorldCell *cell) {
+    if (!cell->result) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [WORLD '%s'] Failed to load map data from '%s'",
+            world->name,
+            cell->path
+        );
+        
+        UnloadWorldCellData(cell);
+        
+        cell->state = LW_WORLD_CELL_FAILED;
+        
+        return;
+    }
+    
+    cell->map.load_texture = world->load_texture;
+    cell->map.lazy_load = world->lazy_load;
+    
+    if (!world->lazy_load) {
+        for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+            if (!cell->map.layers[i]._valid)
+                continue;
+            
+            for (int j = cell->map.layers[i]._first_object; 
+                 j >= 0; 
+                 j = cell->map.layers[i].objects[j]._next)
+                LoadObject(&cell->map, &cell->map.layers[i].objects[j]);
+        }
+    }
+    
+    if (cell->map.load_texture != NULL)
+        BakeStaticLayers(&cell->map);
+    
+    LoadMapJournal(&cell->map, cell->path);
+    
+    if (cell->map.load_texture != NULL)
+        UpdateStaticLayers(&cell->map);
+    
+    cell->state = LW_WORLD_CELL_READY;
+}
+
+/* 
+    백그라운드에서 불러오던 게임 맵 데이터를 모두 불러왔는지 확인한다. `wait`가 `true`이면, 
+    작업이 끝날 때까지 기다린다.
+*/
+static void PollWorldCellLoad(LwWorld *world, LwWorldCell *cell, bool wait) {
+    if (cell->state != LW_WORLD_CELL_LOADING)
+        return;
+    
+#ifndef LOWEL_NO_THREADS
+    if (cell->threaded) {
+        bool done;
+        
+        pthread_mutex_lock(&cell->lock);
+        
+        done = cell->done;
+        
+        pthread_mutex_unlock(&cell->lock);
+        
+        if (!done && !wait)
+            return;
+        
+        pthread_join(cell->thread, NULL);
+        
+        cell->threaded = false;
+    }
+#else
+    (void) wait;
+#endif
+    
+    FinishWorldCellLoad(world, cell);
+}
+
+/* 
+    사각형이 한 축 방향으로 `step`의 부호만큼 움직이기 시작할 때, 사각형이 겹치게 될 타일의 범위를 
+    구한다. 사각형의 가장자리가 타일의 경계에 딱 맞닿아 있다면, 움직이는 방향의 타일도 포함한다.
+*/
+static void GetSweepTileRange(
+    float start, float size, int tile_size, int step, 
+    int *min_tile, int *max_tile
+) {
+    if (step > 0) {
+        *min_tile = (int) floorf(start / tile_size);
+        *max_tile = (int) floorf((start + size) / tile_size);
+    } else if (step < 0) {
+        *min_tile = (int) ceilf(start / tile_size) - 1;
+        *max_tile = (int) ceilf((start + size) / tile_size) - 1;
+    } else {
+        *min_tile = (int) floorf(start / tile_size);
+        *max_tile = (int) ceilf((start + size) / tile_size) - 1;
+    }
+}
+
+/* 개체 `object`에서 고유 번호가 `tile_id`인 타일이 광선을 가로막는지 확인한다. */
+static inline bool IsRayBlockingTile(LwObject *object, int tile_id) {
+    if (tile_id < 0)
+        return false;
+    
+    return (object->solid_tiles == NULL) || IsSolidTileId(object, tile_id);
+}
+
+/* 
+    Amanatides-Woo 방식으로 광선이 지나가는 타일을 따라갈 때 필요한 데이터를 나타내는 구조체.
+    
+    `tile_x`, `tile_y`:       광선이 현재 지나고 있는 타일의 타일 기준 좌표를 나타낸다.
+    `step_x`, `step_y`:       광선이 각 축으로 나아가는 방향을 나타내며, 값은 `-1`, `0` 또는 `1`이다.
+    `t_max_x`, `t_max_y`:     광선이 각 축으로 다음 타일의 경계에 닿을 때까지의 거리를 나타낸다.
+    `t_delta_x`, `t_delta_y`: 광선이 각 축으로 타일 하나를 지나가는 데 필요한 거리를 나타낸다.
+    `time`:                   광선이 현재 타일에 들어온 순간까지의 거리를 나타낸다.
+    `axis`:                   광선이 현재 타일에 들어올 때 지나간 경계의 축을 나타내며, 없다면 `-1`이다.
+*/
+typedef struct LwTileRay {
+    int tile_x, tile_y;
+    int step_x, step_y;
+    float t_max_x, t_max_y;
+    float t_delta_x, t_delta_y;
+    float time;
+    int axis;
+} LwTileRay;
+
+/* 광선을 다음 타일로 한 칸 이동시킨다. */
+static inline void StepTileRay(LwTileRay *ray) {
+    if (ray->t_max_x < ray->t_max_y) {
+        ray->time = ray->t_max_x;
+        ray->tile_x += ray->step_x;
+        ray->t_max_x += ray->t_delta_x;
+        ray->axis = 0;
+    } else {
+        ray->time = ray->t_max_y;
+        ray->tile_y += ray->step_y;
+        ray->t_max_y += ray->t_delta_y;
+        ray->axis = 1;
+    }
+}
+
+/* 
+    타일셋 개체 `object`에서 위치 `origin`으로부터 방향 `direction`으로 광선을 쏘아, 광선을 가로막는 
+    첫 번째 타일을 구한다. 압축된 청크를 읽어야 할 때만 `buffer`에 메모리를 할당하며, 게임 맵과 
+    개체의 데이터는 변경하지 않으므로 여러 스레드에서 동시에 호출할 수 있다.
+    
+    Amanatides-Woo 방식으로 타일을 하나씩 지나가되, 비어 있는 청크 안에서는 타일 데이터를 읽지 않고 
+    청크를 벗어날 때까지 경계만 따라간다.
+*/
+static LwRaycastResult CastTileRay(
+    LwMap *map, LwObject *object, 
+    Vector2 origin, Vector2 direction, float max_distance, 
+    int **buffer
+) {
+    LwRaycastResult result = { .tile_id = -1 };
+    
+    LwTileRay ray = { .axis = -1 };
+    
+    const int *chunk_data = NULL;
+    
+    float length, time_exit;
+    
+    int chunk_index, relative_tile_index, cached_index = -1;
+    int min_x, min_y, max_x, max_y;
+    
+    length = sqrtf((direction.x * direction.x) + (direction.y * direction.y));
+    
+    if (length == 0.0f || max_distance < 0.0f || object->chunkset.chunks == NULL)
+        return result;
+    
+    direction.x /= length;
+    direction.y /= length;
+    
+    /* 광선이 게임 맵과 겹치는 구간 `[ray.time, time_exit]`를 먼저 구한다. */
+    time_exit = max_distance;
+    
+    for (int i = 0; i < 2; i++) {
+        float start = (i == 0) ? origin.x : origin.y;
+        float delta = (i == 0) ? direction.x : direction.y;
+        float size = (i == 0) ? map->width.t * map->tile_width : map->height.t * map->tile_height;
+        
+        float t_near, t_far;
+        
+        if (delta == 0.0f) {
+            if (start < 0.0f || start >= size)
+                return result;
+            
+            continue;
+        }
+        
+        t_near = fminf((0.0f - start) / delta, (size - start) / delta);
+        t_far = fmaxf((0.0f - start) / delta, (size - start) / delta);
+        
+        if (t_near > ray.time) {
+            ray.time = t_near;
+            ray.axis = i;
+        }
+        
+        time_exit = fminf(time_exit, t_far);
+    }
+    
+    if (ray.time > time_exit)
+        return result;
+    
+    ray.tile_x = (int) floorf((origin.x + (direction.x * ray.time)) / map->tile_width);
+    ray.tile_y = (int) floorf((origin.y + (direction.y * ray.time)) / map->tile_height);
+    
+    ray.tile_x = LW_MIN(LW_MAX(ray.tile_x, 0), map->width.t - 1);
+    ray.tile_y = LW_MIN(LW_MAX(ray.tile_y, 0), map->height.t - 1);
+    
+    ray.step_x = (direction.x > 0.0f) - (direction.x < 0.0f);
+    ray.step_y = (direction.y > 0.0f) - (direction.y < 0.0f);
+    
+    ray.t_delta_x = (ray.step_x != 0) ? map->tile_width / fabsf(direction.x) : INFINITY;
+    ray.t_delta_y = (ray.step_y != 0) ? map->tile_height / fabsf(direction.y) : INFINITY;
+    
+    ray.t_max_x = (ray.step_x != 0) 
+        ? (((ray.tile_x + (ray.step_x > 0)) * map->tile_width) - origin.x) / direction.x 
+        : INFINITY;
+    ray.t_max_y = (ray.step_y != 0) 
+        ? (((ray.tile_y + (ray.step_y > 0)) * map->tile_height) - origin.y) / direction.y 
+        : INFINITY;
+    
+    while (ray.tile_x >= 0 && ray.tile_x < map->width.t 
+        && ray.tile_y >= 0 && ray.tile_y < map->height.t) {
+        chunk_index = TileXYToChunkIndex(
+            map, map->width.c, 
+            ray.tile_x, ray.tile_y, 
+            &relative_tile_index
+        );
+        
+        if (!object->chunkset.chunks[chunk_index]._valid) {
+            min_x = GetMapChunkX(map, chunk_index) * map->chunk_width;
+            min_y = GetMapChunkY(map, chunk_index) * map->chunk_height;
+            
+            max_x = min_x + map->chunk_width - 1;
+            max_y = min_y + map->chunk_height - 1;
+            
+            do {
+                StepTileRay(&ray);
+            } while (ray.time <= time_exit
+                && ray.tile_x >= min_x && ray.tile_x <= max_x 
+                && ray.tile_y >= min_y && ray.tile_y <= max_y);
+        } else {
+            if (chunk_index != cached_index) {
+                if (object->chunkset.chunks[chunk_index].data == NULL && *buffer == NULL)
+                    *buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+                
+                chunk_data = PeekChunkData(map, object, chunk_index, *buffer);
+                
+                cached_index = chunk_index;
+            }
+            
+            if (IsRayBlockingTile(object, chunk_data[relative_tile_index])) {
+                result.hit = true;
+                result.distance = ray.time;
+                result.position = (Vector2) { 
+                    origin.x + (direction.x * ray.time), 
+                    origin.y + (direction.y * ray.time) 
+                };
+                result.tile = (LwTileCoord) { ray.tile_x, ray.tile_y };
+                result.tile_id = chunk_data[relative_tile_index];
+                
+                if (ray.axis == 0)
+                    result.normal = (Vector2) { -ray.step_x, 0.0f };
+                else if (ray.axis == 1)
+                    result.normal = (Vector2) { 0.0f, -ray.step_y };
+                
+                return result;
+            }
+            
+            StepTileRay(&ray);
+        }
+        
+        if (ray.time > time_exit)
+            break;
+    }
+    
+    return result;
+}
+
+/* 
+    여러 개의 광선을 한 번에 처리하는 작업을 나타내는 구조체.
+    
+    `map`:     광선을 쏠 게임 맵을 나타낸다.
+    `object`:  광선을 쏠 타일셋 개체를 나타낸다.
+    `queries`: 광선의 배열을 나타낸다.
+    `results`: 광선마다 결과를 저장할 배열을 나타낸다.
+    `begin`:   이 작업이 처리할 첫 번째 광선의 인덱스를 나타낸다.
+    `end`:     이 작업이 처리할 마지막 광선의 다음 인덱스를 나타낸다.
+    `hits`:    타일에 부딪힌 광선의 개수를 나타낸다.
+*/
+typedef struct LwRaycastTask {
+    LwMap *map;
+    LwObject *object;
+    const LwRaycastQuery *queries;
+    LwRaycastResult *results;
+    int begin;
+    int end;
+    int hits;
+} LwRaycastTask;
+
+/* 작업 `task`에 포함된 광선을 모두 처리한다. */
+static void *RunRaycastTask(void *data) {
+    LwRaycastTask *task = (LwRaycastTask *) data;
+    
+    int *buffer = NULL;
+    
+    task->hits = 0;
+    
+    for (int i = task->begin; i < task->end; i++) {
+        task->results[i] = CastTileRay(
+            task->map, task->object, 
+            task->queries[i].origin, task->queries[i].direction, task->queries[i].max_distance, 
+            &buffer
+        );
+        
+        task->hits += task->results[i].hit;
+    }
+    
+    RL_FREE(buffer);
+    
+    return NULL;
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일을 지나갈 수 있는지 확인한다. */
+static inline bool IsTileWalkable(LwMap *map, int tile_x, int tile_y) {
+    return tile_x >= 0 && tile_x < map->width.t 
+        && tile_y >= 0 && tile_y < map->height.t 
+        && !IsTileSolid(map, tile_x, tile_y);
+}
+
+/* 
+    인덱스가 `start`인 타일에서 시작하여, 타일 기준 좌표가 `(min_x, min_y)`부터 `(max_x, max_y)`까지인 
+    범위 안에서만 상하좌우로 이동하는 너비 우선 탐색을 한다. `target`에 도달하면 거리를 반환하고, 
+    도달하지 못하면 `-1`을 반환한다. `target`이 음수라면 범위 안의 모든 타일을 탐색한다.
+*/
+static int SearchPathTiles(
+    LwPathContext *context, 
+    int start, int target, 
+    int min_x, int min_y, int max_x, int max_y
+) {
+    static const int offsets[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+    
+    LwMap *map = context->map;
+    
+    int head = 0, tail = 0;
+    int index, tile_x, tile_y, next_x, next_y, next;
+    
+    context->generation++;
+    
+    context->tile_stamps[start] = context->generation;
+    context->tile_costs[start] = 0;
+    context->tile_parents[start] = -1;
+    
+    context->queue[tail++] = start;
+    
+    while (head < tail) {
+        index = context->queue[head++];
+        
+        if (index == target)
+            return context->tile_costs[index];
+        
+        tile_x = GetMapTileX(map, index);
+        tile_y = GetMapTileY(map, index);
+        
+        for (int i = 0; i < 4; i++) {
+            next_x = tile_x + offsets[i][0];
+            next_y = tile_y + offsets[i][1];
+            
+            if (next_x < min_x || next_x > max_x || next_y < min_y || next_y > max_y
+                || !IsTileWalkable(map, next_x, next_y))
+                continue;
+            
+            next = (next_y * map->width.t) + next_x;
+            
+            if (context->tile_stamps[next] == context->generation)
+                continue;
+            
+            context->tile_stamps[next] = context->generation;
+            context->tile_costs[next] = context->tile_costs[index] + 1;
+            context->tile_parents[next] = index;
+            
+            context->queue[tail++] = next;
+        }
+    }
+    
+    return (target < 0) ? 0 : -1;
+}
+
+/* 게임 맵에서 고유 번호가 `index`인 청크에 속한 타일의 범위를 구한다. */
+static void GetChunkTileBounds(
+    LwMap *map, int index, 
+    int *min_x, int *min_y, int *max_x, int *max_y
+) {
+    *min_x = GetMapChunkX(map, index) * map->chunk_width;
+    *min_y = GetMapChunkY(map, index) * map->chunk_height;
+    
+    *max_x = LW_MIN(*min_x + map->chunk_width, map->width.t) - 1;
+    *max_y = LW_MIN(*min_y + map->chunk_height, map->height.t) - 1;
+}
+
+/* 고유 번호가 `index`인 청크의 출입구와, 출입구 사이의 거리를 다시 계산한다. */
+static void RebuildPathChunk(LwPathContext *context, int index) {
+    LwMap *map = context->map;
+    LwPathGraph *graph = map->_path_graph;
+    
+    int *node_tiles = &graph->node_tiles[index * LW_PATH_MAX_CHUNK_NODES];
+    unsigned char *node_sides = &graph->node_sides[index * LW_PATH_MAX_CHUNK_NODES];
+    unsigned short *distances = &graph->distances[index * LW_PATH_MAX_CHUNK_NODES * LW_PATH_MAX_CHUNK_NODES];
+    
+    int min_x, min_y, max_x, max_y;
+    int length, run_start, tile_x, tile_y, count = 0;
+    
+    GetChunkTileBounds(map, index, &min_x, &min_y, &max_x, &max_y);
+    
+    /* 왼쪽, 오른쪽, 위쪽, 아래쪽 경계를 차례대로 따라가면서, 양쪽 모두 지나갈 수 있는 구간을 찾는다. */
+    for (int side = 0; side < 4; side++) {
+        bool vertical = (side < 2);
+        
+        int edge = (side == 0) ? min_x : (side == 1) ? max_x : (side == 2) ? min_y : max_y;
+        int outside = (side == 0 || side == 2) ? edge - 1 : edge + 1;
+        
+        if (outside < 0 || outside > (vertical ? map->width.t : map->height.t) - 1)
+            continue;
+        
+        length = vertical ? (max_y - min_y + 1) : (max_x - min_x + 1);
+        run_start = -1;
+        
+        for (int i = 0; i <= length; i++) {
+            bool open = false;
+            
+            if (i < length) {
+                tile_x = vertical ? edge : min_x + i;
+                tile_y = vertical ? min_y + i : edge;
+                
+                open = IsTileWalkable(map, tile_x, tile_y) && (vertical 
+                    ? IsTileWalkable(map, outside, tile_y) 
+                    : IsTileWalkable(map, tile_x, outside));
+            }
+            
+            if (open && run_start < 0) {
+                run_start = i;
+            } else if (!open && run_start >= 0) {
+                if (count < LW_PATH_MAX_CHUNK_NODES) {
+                    int middle = (run_start + i - 1) / 2;
+                    
+                    node_tiles[count] = vertical 
+                        ? ((min_y + middle) * map->width.t) + edge
+                        : (edge * map->width.t) + (min_x + middle);
+                    node_sides[count] = (unsigned char) side;
+                    
+                    count++;
+                }
+                
+                run_start = -1;
+            }
+        }
+    }
+    
+    graph->node_counts[index] = count;
+    
+    for (int i = 0; i < count; i++) {
+        SearchPathTiles(context, node_tiles[i], -1, min_x, min_y, max_x, max_y);
+        
+        for (int j = 0; j < count; j++)
+            distances[(i * LW_PATH_MAX_CHUNK_NODES) + j] = 
+                (context->tile_stamps[node_tiles[j]] == context->generation)
+                    ? (unsigned short) LW_MIN(context->tile_costs[node_tiles[j]], LW_PATH_NO_EDGE - 1)
+                    : LW_PATH_NO_EDGE;
+    }
+    
+    graph->stale[index] = false;
+}
+
+/* 경로 탐색에 사용되는 청크의 출입구 그래프에 할당된 메모리를 해제한다. */
+static void UnloadPathGraph(LwMap *map) {
+    if (map->_path_graph == NULL)
+        return;
+    
+    RL_FREE(map->_path_graph->node_tiles);
+    RL_FREE(map->_path_graph->node_sides);
+    RL_FREE(map->_path_graph->node_counts);
+    RL_FREE(map->_path_graph->distances);
+    RL_FREE(map->_path_graph->stale);
+    RL_FREE(map->_path_graph);
+    
+    map->_path_graph = NULL;
+}
+
+/* 
+    경로 탐색에 사용되는 청크의 출입구를 최신 상태로 만든다. 처음 호출할 때는 모든 청크의 출입구를 
+    계산하고, 이후에는 `LW_DIRTY_PATH`로 표시된 청크와 그 이웃한 청크의 출입구만 다시 계산한다.
+*/
+static void UpdatePathGraph(LwPathContext *context) {
+    LwMap *map = context->map;
+    LwPathGraph *graph;
+    LwObject *object;
+    
+    int chunk_index, chunk_x, chunk_y;
+    
+    if (map->_path_graph == NULL) {
+        graph = map->_path_graph = (LwPathGraph *) RL_CALLOC(1, sizeof(LwPathGraph));
+        
+        graph->chunk_count = map->width.c * map->height.c;
+        
+        graph->node_tiles = (int *) RL_CALLOC(
+            graph->chunk_count * LW_PATH_MAX_CHUNK_NODES, 
+            sizeof(int)
+        );
+        graph->node_sides = (unsigned char *) RL_CALLOC(
+            graph->chunk_count * LW_PATH_MAX_CHUNK_NODES, 
+            sizeof(unsigned char)
+        );
+        graph->node_counts = (int *) RL_CALLOC(graph->chunk_count, sizeof(int));
+        graph->distances = (unsigned short *) RL_CALLOC(
+            graph->chunk_count * LW_PATH_MAX_CHUNK_NODES * LW_PATH_MAX_CHUNK_NODES, 
+            sizeof(unsigned short)
+        );
+        graph->stale = (bool *) RL_CALLOC(graph->chunk_count, sizeof(bool));
+        
+        for (int i = 0; i < graph->chunk_count; i++)
+            graph->stale[i] = true;
+    }
+    
+    graph = map->_path_graph;
+    
+    /* 경계의 출입구는 이웃한 청크와 함께 정해지므로, 이웃한 청크도 다시 계산한다. */
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!HasSolidTiles(object))
+                continue;
+            
+            for (int k = 0; k < object->chunkset.dirty_count; k++) {
+                chunk_index = object->chunkset.dirty_indexes[k];
+                
+                if (!(object->chunkset.chunks[chunk_index].dirty & LW_DIRTY_PATH))
+                    continue;
+                
+                chunk_x = GetMapChunkX(map, chunk_index);
+                chunk_y = GetMapChunkY(map, chunk_index);
+                
+                graph->stale[chunk_index] = true;
+                
+                if (chunk_x > 0) graph->stale[chunk_index - 1] = true;
+                if (chunk_x < map->width.c - 1) graph->stale[chunk_index + 1] = true;
+                if (chunk_y > 0) graph->stale[chunk_index - map->width.c] = true;
+                if (chunk_y < map->height.c - 1) graph->stale[chunk_index + map->width.c] = true;
+            }
+            
+            ClearDirtyChunks(object, LW_DIRTY_PATH);
+        }
+    }
+    
+    for (int i = 0; i < graph->chunk_count; i++)
+        if (graph->stale[i])
+            RebuildPathChunk(context, i);
+}
+
+/* 경로 탐색의 이진 힙에서 `position`번째 노드를 알맞은 위치로 옮긴다. */
+static void SiftPathHeap(LwPathContext *context, int position) {
+    int *heap = context->heap;
+    int *scores = context->node_scores;
+    
+    int node = heap[position], parent, child;
+    
+    while (position > 0 && scores[heap[parent = (position - 1) / 2]] > scores[node]) {
+        heap[position] = heap[parent];
+        context->heap_positions[heap[position]] = position;
+        
+        position = parent;
+    }
+    
+    for (;;) {
+        child = (2 * position) + 1;
+        
+        if (child > context->heap_size - 1)
+            break;
+        
+        if (child + 1 < context->heap_size && scores[heap[child + 1]] < scores[heap[child]])
+            child++;
+        
+        if (scores[heap[child]] >= scores[node])
+            break;
+        
+        heap[position] = heap[child];
+        context->heap_positions[heap[position]] = position;
+        
+        position = child;
+    }
+    
+    heap[position] = node;
+    context->heap_positions[node] = position;
+}
+
+/* 
+    노드 `node`까지의 거리가 `cost`인 경로를 찾았을 때, 더 짧은 경로라면 노드의 거리를 갱신하고 
+    열린 목록에 추가한다.
+*/
+static void RelaxPathNode(LwPathContext *context, int node, int parent, int cost, int heuristic) {
+    if (context->node_stamps[node] == context->generation && context->node_costs[node] <= cost)
+        return;
+    
+    if (context->node_stamps[node] != context->generation) {
+        context->node_stamps[node] = context->generation;
+        context->heap_positions[node] = -1;
+    }
+    
+    context->node_costs[node] = cost;
+    context->node_scores[node] = cost + heuristic;
+    context->node_parents[node] = parent;
+    
+    if (context->heap_positions[node] < 0) {
+        context->heap[context->heap_size] = node;
+        context->heap_positions[node] = context->heap_size++;
+    }
+    
+    SiftPathHeap(context, context->heap_positions[node]);
+}
+
+/* 경로 탐색의 이진 힙에서 점수가 가장 낮은 노드를 꺼낸다. */
+static int PopPathHeap(LwPathContext *context) {
+    int node = context->heap[0];
+    
+    context->heap_positions[node] = -2;
+    
+    if (--context->heap_size > 0) {
+        context->heap[0] = context->heap[context->heap_size];
+        context->heap_positions[context->heap[0]] = 0;
+        
+        SiftPathHeap(context, 0);
+    }
+    
+    return node;
+}
+
+/* 
+    너비 우선 탐색으로 찾은, 인덱스가 `target`인 타일까지의 경로를 `path`의 `offset`번째 칸부터 
+    저장한다. 탐색을 시작한 타일은 저장하지 않으며, 저장한 경로의 길이를 반환한다.
+*/
+static int WritePathTiles(
+    LwPathContext *context, int target, 
+    LwTileCoord *path, int offset, int max_length
+) {
+    int length = context->tile_costs[target];
+    
+    for (int i = length - 1, index = target; i >= 0; i--, index = context->tile_parents[index])
+        if (offset + i < max_length)
+            path[offset + i] = (LwTileCoord) { 
+                GetMapTileX(context->map, index), 
+                GetMapTileY(context->map, index) 
+            };
+    
+    return length;
+}
+
+/* 출입구 노드 `node`와 이웃한 청크에서 맞닿아 있는 출입구 노드를 반환한다. 없다면 `-1`을 반환한다. */
+static int GetPathNodePartner(LwPathContext *context, int node) {
+    LwMap *map = context->map;
+    LwPathGraph *graph = map->_path_graph;
+    
+    int chunk_index = node / LW_PATH_MAX_CHUNK_NODES;
+    int tile = graph->node_tiles[node], side = graph->node_sides[node];
+    
+    int partner_chunk = (side == 0) ? chunk_index - 1 
+        : (side == 1) ? chunk_index + 1 
+        : (side == 2) ? chunk_index - map->width.c 
+        : chunk_index + map->width.c;
+    int partner_tile = (side == 0) ? tile - 1 
+        : (side == 1) ? tile + 1 
+        : (side == 2) ? tile - map->width.t 
+        : tile + map->width.t;
+    
+    for (int i = 0; i < graph->node_counts[partner_chunk]; i++) {
+        int partner = (partner_chunk * LW_PATH_MAX_CHUNK_NODES) + i;
+        
+        if (graph->node_tiles[partner] == partner_tile && graph->node_sides[partner] == (side ^ 1))
+            return partner;
+    }
+    
+    return -1;
+}
+
+/* 개체 `object`가 레이어 `layer`에서 미니맵에 그려지는 타일셋 개체인지 확인한다. */
+static inline bool IsMinimapObject(LwLayer *layer, LwObject *object) {
+    return IsDefaultParallax(layer) && object->_valid && object->tileset && !object->auto_split;
+}
+
+/* 
+    타일셋 개체 `object`의 이미지를 CPU 메모리에 불러와서, 타일마다 불투명도를 가중치로 한 
+    평균 색상을 구한다. 이미지를 불러올 수 없다면, 모든 타일을 투명하게 그린다.
+*/
+static void LoadTileColors(LwMap *map, LwObject *object) {
+    Image image;
+    Color *pixels, color;
+    
+    uint64_t sum_r, sum_g, sum_b, sum_a;
+    
+    int columns, rows, tile_x, tile_y;
+    
+    if (object->tile_colors != NULL)
+        return;
+    
+    image = LoadImage(object->image_path);
+    
+    if (image.data == NULL) {
+        TraceLog(
+            LOG_WARNING, 
+            "LOWEL: [MAP '%s': %s] Unable to load image for minimap colors of object #%d",
+            map->name,
+            object->image_path,
+            object->id
+        );
+        
+        object->tile_colors = (uint32_t *) RL_CALLOC(1, sizeof(uint32_t));
+        object->tile_color_count = 1;
+        
+        return;
+    }
+    
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    
+    pixels = (Color *) image.data;
+    
+    columns = image.width / map->tile_width;
+    rows = image.height / map->tile_height;
+    
+    object->tile_color_count = (columns * rows) + 1;
+    object->tile_colors = (uint32_t *) RL_CALLOC(object->tile_color_count, sizeof(uint32_t));
+    
+    for (int i = 0; i < columns * rows; i++) {
+        tile_x = (i % columns) * map->tile_width;
+        tile_y = (i / columns) * map->tile_height;
+        
+        sum_r = sum_g = sum_b = sum_a = 0;
+        
+        for (int y = tile_y; y < tile_y + map->tile_height; y++) {
+            for (int x = tile_x; x < tile_x + map->tile_width; x++) {
+                color = pixels[(y * image.width) + x];
+                
+                sum_r += color.r * color.a;
+                sum_g += color.g * color.a;
+                sum_b += color.b * color.a;
+                sum_a += color.a;
+            }
+        }
+        
+        if (sum_a == 0)
+            continue;
+        
+        color = (Color) {
+            (unsigned char) (sum_r / sum_a),
+            (unsigned char) (sum_g / sum_a),
+            (unsigned char) (sum_b / sum_a),
+            (unsigned char) LW_MAX(sum_a / (map->tile_width * map->tile_height), 1)
+        };
+        
+        /* 이미지의 픽셀과 같은 바이트 순서로 저장해두면, 색상을 그대로 복사할 수 있다. */
+        memcpy(&object->tile_colors[i + 1], &color, sizeof(uint32_t));
+    }
+    
+    UnloadImage(image);
+}
+
+/* 
+    고유 번호가 `index`인 청크에 그려지는 모든 타일셋 개체의 청크 번호를 하나로 합친 값을 구한다. 
+    청크의 타일이 바뀌거나 개체가 추가, 제거되면 값이 바뀐다.
+*/
+static uint64_t GetMinimapSignature(LwMap *map, int index) {
+    LwObject *object;
+    
+    uint64_t signature = 14695981039346656037ULL;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!IsMinimapObject(&map->layers[i], object) || object->chunkset.chunks == NULL)
+                continue;
+            
+            signature = (signature ^ object->chunkset.chunks[index].revision) * 1099511628211ULL;
+        }
+    }
+    
+    return signature;
+}
+
+/* 
+    미니맵을 다시 그리는 작업 하나를 나타내는 구조체.
+    
+    `map`:     미니맵을 그릴 게임 맵을 나타낸다.
+    `minimap`: 다시 그릴 미니맵을 나타낸다.
+    `indexes`: 다시 그릴 청크의 고유 번호 배열을 나타낸다.
+    `begin`:   이 작업이 처리할 첫 번째 청크의 `indexes`에서의 인덱스를 나타낸다.
+    `end`:     이 작업이 처리할 마지막 청크의 다음 인덱스를 나타낸다.
+*/
+typedef struct LwMinimapTask {
+    LwMap *map;
+    LwMinimap *minimap;
+    const int *indexes;
+    int begin;
+    int end;
+} LwMinimapTask;
+
+/* 
+    작업 `task`에 포함된 청크를 미니맵에 다시 그린다. 타일의 고유 번호로 색상 표를 찾아서 불투명한 
+    색상만 덮어쓰는 반복문은 분기 없이 작성되어 있으므로, 컴파일러가 SIMD 명령어로 벡터화할 수 있다.
+*/
+static void *RunMinimapTask(void *data) {
+    LwMinimapTask *task = (LwMinimapTask *) data;
+    LwMap *map = task->map;
+    LwObject *object;
+    
+    const uint32_t *restrict lut;
+    const int *restrict chunk_data;
+    uint32_t *restrict colors;
+    uint32_t *pixels = (uint32_t *) task->minimap->image.data;
+    
+    int *buffer;
+    
+    uint32_t alpha_mask, color;
+    unsigned int lut_size, lut_index;
+    
+    int chunk_size = map->chunk_width * map->chunk_height;
+    int chunk_index, origin_x, origin_y, row_width;
+    
+    /* 바이트 순서와 상관없이, 불투명도에 해당하는 비트만 골라낸다. */
+    memcpy(&alpha_mask, &(Color) { 0, 0, 0, 255 }, sizeof(uint32_t));
+    
+    buffer = (int *) RL_MALLOC(chunk_size * sizeof(int));
+    colors = (uint32_t *) RL_MALLOC(chunk_size * sizeof(uint32_t));
+    
+    for (int i = task->begin; i < task->end; i++) {
+        chunk_index = task->indexes[i];
+        
+        memset(colors, 0, chunk_size * sizeof(uint32_t));
+        
+        for (int j = 0; j < MAX_LAYER_COUNT; j++) {
+            if (!map->layers[j]._valid)
+                continue;
+            
+            for (int k = map->layers[j]._first_object; k >= 0; k = map->layers[j].objects[k]._next) {
+                object = &map->layers[j].objects[k];
+                
+                if (!IsMinimapObject(&map->layers[j], object) || object->chunkset.chunks == NULL
+                    || !object->chunkset.chunks[chunk_index]._valid)
+                    continue;
+                
+                /* 스레드에서는 청크의 압축을 풀어서 저장하지 않고, 버퍼에만 풀어서 읽는다. */
+                chunk_data = PeekChunkData(map, object, chunk_index, buffer);
+                
+                lut = object->tile_colors;
+                lut_size = (unsigned int) object->tile_color_count;
+                
+                for (int l = 0; l < chunk_size; l++) {
+                    lut_index = (unsigned int) (chunk_data[l] + 1);
+                    color = lut[(lut_index < lut_size) ? lut_index : 0];
+                    colors[l] = (color & alpha_mask) ? color : colors[l];
+                }
+            }
+        }
+        
+        origin_x = GetMapChunkX(map, chunk_index) * map->chunk_width;
+        origin_y = GetMapChunkY(map, chunk_index) * map->chunk_height;
+        
+        row_width = LW_MIN(map->chunk_width, map->width.t - origin_x);
+        
+        for (int tile_y = 0; tile_y < map->chunk_height && origin_y + tile_y < map->height.t; tile_y++)
+            memcpy(
+                &pixels[((origin_y + tile_y) * map->width.t) + origin_x],
+                &colors[tile_y * map->chunk_width],
+                row_width * sizeof(uint32_t)
+            );
+    }
+    
+    RL_FREE(buffer);
+    RL_FREE(colors);
+    
+    return NULL;
+}
+
+/* 타일 고유 번호의 비트 배열 `a`와 `b`가 같은 타일을 나타내는지 확인한다. */
+static bool IsTileIdBitsEqual(const uint32_t *a, int a_count, const uint32_t *b, int b_count) {
+    uint32_t a_word, b_word;
+    
+    for (int i = 0; i < ((LW_MAX(a_count, b_count) + 31) >> 5); i++) {
+        a_word = (i < ((a_count + 31) >> 5)) ? a[i] : 0;
+        b_word = (i < ((b_count + 31) >> 5)) ? b[i] : 0;
+        
+        if (a_word != b_word)
+            return false;
+    }
+    
+    return true;
+}
+
+/* 
+    게임 맵 `source`에서 고유 번호가 `object_id`인 개체를 게임 맵 `map`의 같은 레이어로 옮긴다. 
+    같은 이미지를 사용하는 개체가 이미 있다면 그 텍스처를 함께 사용하고, 없다면 새로 불러온다.
+*/
+static void AdoptObject(LwMap *map, LwMap *source, int object_id) {
+    LwObject *object, *other;
+    
+    int layer_id = source->object_table[object_id];
+    
+    InitLayer(map, layer_id);
+    
+    UnlinkObject(&source->layers[layer_id], object_id);
+    
+    object = &map->layers[layer_id].objects[object_id];
+    
+    *object = source->layers[layer_id].objects[object_id];
+    
+    source->layers[layer_id].objects[object_id] = (LwObject) { ._prev = -1, ._next = -1 };
+    
+    map->object_table[object_id] = layer_id;
+    
+    /* 사용 중인 고유 번호가 되었으므로, 고유 번호의 순서를 유지하면서 목록에서 뺀다. */
+    for (int i = 0; i < map->_pool->free_count; i++) {
+        if (map->_pool->free_ids[i] != object_id)
+            continue;
+        
+        memmove(
+            &map->_pool->free_ids[i], 
+            &map->_pool->free_ids[i + 1], 
+            (map->_pool->free_count - i - 1) * sizeof(int)
+        );
+        
+        map->_pool->free_count--;
+        
+        break;
+    }
+    
+    LinkObject(&map->layers[layer_id], object_id, true);
+    
+    for (int i = 0; i < MAX_LAYER_COUNT && object->image_path != NULL && !object->texture.id; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            other = &map->layers[i].objects[j];
+            
+            if (other != object && other->texture.id && TextIsEqual(other->image_path, object->image_path)) {
+                object->texture = other->texture;
+                
+                break;
+            }
+        }
+    }
+    
+    if (!object->texture.id && object->image_path != NULL && map->load_texture != NULL)
+        object->texture = map->load_texture(object->image_path);
+    
+    object->loaded = true;
+    
+    UpdateObjectSize(map, object);
+    
+    /* 텍스처를 자르는 개체의 청크는 텍스처의 크기에 따라 달라지므로, 텍스처를 불러온 다음에 다시 만든다. */
+    if (!object->tileset && object->auto_split) {
+        UnloadChunkSet(object);
+        
+        LoadTileData(map, object, NULL);
+    }
+    
+    for (int i = 0; object->chunkset.chunks != NULL && i < object->chunkset.count; i++)
+        if (object->chunkset.chunks[i]._valid)
+            MarkChunkDirty(map, object, i, LW_DIRTY_ALL & ~LW_DIRTY_SAVE);
+}
+
+/* 
+    게임 맵 `source`의 타일셋 개체 `next`의 타일 데이터를 게임 맵 `map`의 같은 개체 `object`와 비교하여, 
+    바뀐 타일이 있는 청크만 다시 쓰고 변경 사항을 표시한다. 바뀐 청크의 개수를 반환한다.
+*/
+static int ApplyTileDataChanges(LwMap *map, LwObject *object, LwMap *source, LwObject *next) {
+    LwChunkSet chunkset;
+    
+    const int *chunk_data, *next_data;
+    
+    int *data, *buffer, *next_buffer;
+    
+    bool *autotiled;
+    
+    int chunk_size = map->chunk_width * map->chunk_height, changed_count = 0, flags;
+    int tile_x, tile_y;
+    
+    if (next->chunkset.chunks == NULL)
+        return 0;
+    
+    /* 아직 타일 데이터를 불러오지 않은 개체라면, 새로 읽은 청크 배열을 그대로 사용한다. */
+    if (object->tiledata_offset >= 0 || object->chunkset.chunks == NULL) {
+        chunkset = object->chunkset;
+        object->chunkset = next->chunkset;
+        next->chunkset = chunkset;
+        
+        object->tiledata_offset = -1;
+        
+        for (int i = 0; i < object->chunkset.count; i++)
+            if (object->chunkset.chunks[i]._valid)
+                MarkChunkDirty(map, object, i, LW_DIRTY_ALL & ~LW_DIRTY_SAVE);
+        
+        return object->chunkset.count;
+    }
+    
+    flags = HasSolidTiles(object) 
+        ? (LW_DIRTY_ALL & ~LW_DIRTY_SAVE) 
+        : (LW_DIRTY_ALL & ~(LW_DIRTY_SAVE | LW_DIRTY_PATH));
+    
+    buffer = (int *) RL_MALLOC(chunk_size * sizeof(int));
+    next_buffer = (int *) RL_MALLOC(chunk_size * sizeof(int));
+    
+    for (int i = 0; i < LW_MIN(object->chunkset.count, next->chunkset.count); i++) {
+        /* 라이브러리가 고른 자동 타일의 표시는 새로 읽은 타일 데이터를 따른다. */
+        autotiled = object->chunkset.chunks[i]._autotiled;
+        object->chunkset.chunks[i]._autotiled = next->chunkset.chunks[i]._autotiled;
+        next->chunkset.chunks[i]._autotiled = autotiled;
+        
+        chunk_data = PeekChunkData(map, object, i, buffer);
+        next_data = PeekChunkData(source, next, i, next_buffer);
+        
+        if (memcmp(chunk_data, next_data, chunk_size * sizeof(int)) == 0)
+            continue;
+        
+        data = GetChunkData(map, object, i);
+        
+        for (int j = 0; j < chunk_size; j++) {
+            if (data[j] == next_data[j])
+                continue;
+            
+            data[j] = next_data[j];
+            
+            if (data[j] >= 0)
+                object->chunkset.chunks[i]._valid = true;
+            
+            tile_x = (GetMapChunkX(map, i) * map->chunk_width) + (j % map->chunk_width);
+            tile_y = (GetMapChunkY(map, i) * map->chunk_height) + (j / map->chunk_width);
+            
+            if (tile_x > map->width.t - 1 || tile_y > map->height.t - 1)
+                continue;
+            
+            if (object->solid_tiles != NULL)
+                UpdateSolidTile(map, tile_x, tile_y);
+            
+            if (object->opaque_tiles != NULL)
+                UpdateLightTile(map, tile_x, tile_y);
+        }
+        
+        if (object->animation_count > 0)
+            UpdateAnimatedTiles(map, object, i, data);
+        
+        MarkChunkDirty(map, object, i, flags);
+        
+        changed_count++;
+    }
+    
+    RL_FREE(buffer);
+    RL_FREE(next_buffer);
+    
+    return changed_count;
+}
+
+/* 
+    개체 `object`와 `next`의 충돌 판정, 조명, 애니메이션, 자동 타일 데이터를 서로 맞바꾼다. 
+    맞바꾼 이전 데이터는 `next`와 함께 해제된다.
+*/
+static void SwapObjectProperties(LwObject *object, LwObject *next) {
+    LwObject temp = *object;
+    
+    object->solid_tiles = next->solid_tiles;
+    object->solid_tile_count = next->solid_tile_count;
+    object->opaque_tiles = next->opaque_tiles;
+    object->opaque_tile_count = next->opaque_tile_count;
+    object->animations = next->animations;
+    object->animation_count = next->animation_count;
+    object->animation_lookup = next->animation_lookup;
+    object->animation_lookup_size = next->animation_lookup_size;
+    object->autotiles = next->autotiles;
+    object->autotile_count = next->autotile_count;
+    object->autotile_lookup = next->autotile_lookup;
+    object->autotile_lookup_size = next->autotile_lookup_size;
+    object->autotile_variant_lookup = next->autotile_variant_lookup;
+    object->autotile_variant_lookup_size = next->autotile_variant_lookup_size;
+    
+    next->solid_tiles = temp.solid_tiles;
+    next->solid_tile_count = temp.solid_tile_count;
+    next->opaque_tiles = temp.opaque_tiles;
+    next->opaque_tile_count = temp.opaque_tile_count;
+    next->animations = temp.animations;
+    next->animation_count = temp.animation_count;
+    next->animation_lookup = temp.animation_lookup;
+    next->animation_lookup_size = temp.animation_lookup_size;
+    next->autotiles = temp.autotiles;
+    next->autotile_count = temp.autotile_count;
+    next->autotile_lookup = temp.autotile_lookup;
+    next->autotile_lookup_size = temp.autotile_lookup_size;
+    next->autotile_variant_lookup = temp.autotile_variant_lookup;
+    next->autotile_variant_lookup_size = temp.autotile_variant_lookup_size;
+}
+
+/* 
+    미리 합성된 정적 레이어와 축소 이미지를 모두 지우고, 레이어의 구성에 맞게 처음부터 다시 만든다. 
+    개체의 텍스처는 다시 불러오지 않는다.
+*/
+static void RebakeStaticLayers(LwMap *map) {
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = 0; map->layers[i]._baked != NULL && j < (map->width.c * map->height.c); j++)
+            if (map->layers[i]._baked[j]._valid)
+                UnloadRenderTexture(map->layers[i]._baked[j].target);
+        
+        RL_FREE(map->layers[i]._baked);
+        
+        map->layers[i]._baked = NULL;
+        map->layers[i]._merged = false;
+    }
+    
+    if (map->load_texture != NULL)
+        BakeStaticLayers(map);
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++)
+        if (map->layers[i]._valid)
+            ResetLayerLod(map, i);
+}
+
+/* ::: 게임 맵 관련 함수 ::: */
+
+/* 파일에서 게임 맵 데이터를 불러온다. 저널 파일이 있다면, 저널 파일의 변경 사항도 함께 적용한다. */
+bool LoadMap(LwMap *map, const char *file_path) {
+    char *map_data;
+    
+    bool result;
+    
+    if ((map_data = (char *) LoadFileText(file_path)) == NULL)
+        return false;
+    
+    result = LoadMapFromMemory(map, map_data);
+    
+    RL_FREE(map_data);
+    
+    if (!result || !LoadMapJournal(map, file_path))
+        return false;
+    
+    if (map->load_texture != NULL)
+        UpdateStaticLayers(map);
+    
+    return true;
+}
+
+/* 메모리에서 게임 맵 데이터를 불러온다. */
+bool LoadMapFromMemory(LwMap *map, char *map_data) {
+    JsonArena *arena;
+    JsonNode *node_root, *node_current;
+    
+    bool result;
+    
+    /* 불러온 데이터는 모두 복사되므로, JSON 트리 전체를 한 번에 해제할 수 있는 아레나를 사용한다. */
+    arena = json_arena_new();
+    
+    if (map->lazy_load) {
+        /* 개체의 타일 데이터는 나중에 불러와야 하므로, 원본 데이터를 복사하여 보관한다. */
+        map->_source = (char *) RL_MALLOC(TextLength(map_data) + 1);
+        
+        TextCopy(map->_source, map_data);
+        
+        node_root = json_decode_raw(map->_source, arena, "tiledata");
+    } else {
+        node_root = json_decode_arena(map_data, arena);
+    }
+
+    if (node_root == NULL) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: Failed to load map data: `json_decode()` error"
+        );
+        
+        json_arena_free(arena);
+        
+        return false;
+    }
+    
+    node_current = json_first_child(node_root);
+    
+    result = LoadHeaderData(map, &node_current) 
+        && LoadOptionsData(map, &node_current)
+        && LoadLayersData(map, &node_current);
+    
+    json_arena_free(arena);
+    
+    if (!result)
+        return false;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            /* 충돌 판정에 필요한 타일 데이터는, 개체를 나중에 불러오더라도 미리 불러온다. */
+            if (map->layers[i].objects[j].solid_tiles != NULL)
+                LoadObjectTileData(map, &map->layers[i].objects[j]);
+            
+            /* 
+                자동 타일 규칙과 애니메이션이 타일 데이터보다 나중에 정의될 수도 있으므로, 
+                개체를 모두 읽은 다음에 지형에 맞는 타일을 고르고 애니메이션 목록을 만든다.
+            */
+            if (!map->lazy_load) {
+                ResolveAutotileRect(
+                    map, &map->layers[i].objects[j], 
+                    0, 0, map->width.t - 1, map->height.t - 1, 
+                    LW_DIRTY_NONE
+                );
+                
+                BuildAnimatedTiles(map, &map->layers[i].objects[j]);
+            }
+        }
+    }
+    
+    BuildCollisionGrid(map);
+    
+    if (map->load_texture != NULL)
+        BakeStaticLayers(map);
+  
+    TraceLog(
+        LOG_INFO, 
+        "LOWEL: [MAP '%s'] Loaded map data successfully",
+        map->name
+    );
+    
+    return true;
+}
+
+/* 
+    파일에서 게임 맵 데이터를 다시 읽어, 지금 게임 맵과 개체 및 청크 단위로 비교한 다음 달라진 부분만 
+    반영한다. 위치가 바뀐 개체는 옮기고, 타일이 바뀐 청크만 다시 쓰며, 새로 생긴 개체와 사라진 개체만 
+    만들거나 제거한다. 바뀌지 않은 개체의 텍스처와 청크는 그대로 남는다. 게임 맵이나 청크, 타일의 
+    크기가 바뀌었다면 게임 맵 전체를 다시 불러온다.
+*/
+bool ReloadMap(LwMap *map, const char *file_path) {
+    LwMap next = { .compression = map->compression }, fresh;
+    LwObject *object, *next_object;
+    
+    int layer_id, added = 0, removed = 0, moved = 0, changed_count = 0;
+    
+    bool rebake = false, collision = false, lighting = false;
+    
+    if (map->_pool == NULL)
+        return LoadMap(map, file_path);
+    
+    /* 새로 읽은 데이터는 비교에만 사용하므로, 텍스처는 불러오지 않는다. */
+    if (!LoadMap(&next, file_path))
+        return false;
+    
+    if (next.width.px != map->width.px || next.height.px != map->height.px
+        || next.tile_width != map->tile_width || next.tile_height != map->tile_height
+        || next.chunk_width != map->chunk_width || next.chunk_height != map->chunk_height
+        || next.draw_distance != map->draw_distance) {
+        UnloadMap(&next);
+        
+        fresh = (LwMap) { 
+            .compression = map->compression,
+            .lazy_load = map->lazy_load,
+            .load_texture = map->load_texture
+        };
+        
+        if (!LoadMap(&fresh, file_path))
+            return false;
+        
+        fresh._watch = map->_watch;
+        map->_watch = NULL;
+        
+        UnloadMap(map);
+        
+        *map = fresh;
+        
+        TraceLog(
+            LOG_INFO, 
+            "LOWEL: [MAP '%s'] Reloaded entire map: the size of map has changed",
+            map->name
+        );
+        
+        return true;
+    }
+    
+    TextCopy(map->name, next.name);
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!next.layers[i]._valid)
+            continue;
+        
+        InitLayer(map, i);
+        
+        if (map->layers[i].is_static != next.layers[i].is_static
+            || map->layers[i].parallax.x != next.layers[i].parallax.x
+            || map->layers[i].parallax.y != next.layers[i].parallax.y) {
+            map->layers[i].is_static = next.layers[i].is_static;
+            map->layers[i].parallax = next.layers[i].parallax;
+            
+            rebake = true;
+        }
+    }
+    
+    for (int i = 0; i < MAX_OBJECT_COUNT; i++) {
+        object = GetObject(map, i);
+        next_object = GetObject(&next, i);
+        
+        if (object == NULL && next_object == NULL)
+            continue;
+        
+        /* 같은 레이어에서 같은 이미지를 사용하는 개체는 그대로 두고, 바뀐 속성과 타일만 반영한다. */
+        if (object != NULL && next_object != NULL 
+            && map->object_table[i] == next.object_table[i]
+            && object->tileset == next_object->tileset 
+            && object->auto_split == next_object->auto_split
+            && TextIsEqual(
+                (object->image_path != NULL) ? object->image_path : "", 
+                (next_object->image_path != NULL) ? next_object->image_path : ""
+            )) {
+            layer_id = map->object_table[i];
+            
+            if (object->position.x != next_object->position.x 
+                || object->position.y != next_object->position.y
+                || object->scale != next_object->scale 
+                || object->rotation != next_object->rotation) {
+                object->position = next_object->position;
+                object->scale = next_object->scale;
+                object->rotation = next_object->rotation;
+                
+                UpdateObjectSize(map, object);
+                
+                if (map->layers[layer_id].is_static)
+                    rebake = true;
+                else if (IsLodObject(&map->layers[GetLodLayerId(map, layer_id)], object))
+                    ResetLayerLod(map, layer_id);
+                
+                moved++;
+            }
+            
+            collision |= !IsTileIdBitsEqual(
+                object->solid_tiles, object->solid_tile_count, 
+                next_object->solid_tiles, next_object->solid_tile_count
+            );
+            
+            lighting |= !IsTileIdBitsEqual(
+                object->opaque_tiles, object->opaque_tile_count, 
+                next_object->opaque_tiles, next_object->opaque_tile_count
+            );
+            
+            SwapObjectProperties(object, next_object);
+            
+            if (object->tileset && !object->auto_split)
+                changed_count += ApplyTileDataChanges(map, object, &next, next_object);
+            
+            if (object->animation_count > 0 || next_object->animation_count > 0)
+                BuildAnimatedTiles(map, object);
+            
+            continue;
+        }
+        
+        if (object != NULL) {
+            rebake |= map->layers[map->object_table[i]].is_static;
+            
+            DestroyObject(map, GetObjectHandle(map, object));
+            
+            removed++;
+        }
+        
+        if (next_object != NULL) {
+            layer_id = next.object_table[i];
+            
+            AdoptObject(map, &next, i);
+            
+            object = &map->layers[layer_id].objects[i];
+            
+            collision |= HasSolidTiles(object);
+            lighting |= HasOpaqueTiles(object);
+            
+            if (map->layers[layer_id].is_static)
+                rebake = true;
+            else if (IsLodObject(&map->layers[GetLodLayerId(map, layer_id)], object))
+                ResetLayerLod(map, layer_id);
+            
+            added++;
+        }
+    }
+    
+    UnloadMap(&next);
+    
+    if (collision)
+        BuildCollisionGrid(map);
+    
+    if (lighting)
+        RebuildLight(map);
+    
+    if (rebake)
+        RebakeStaticLayers(map);
+    
+    if (map->load_texture != NULL)
+        UpdateStaticLayers(map);
+    
+    TraceLog(
+        LOG_INFO, 
+        "LOWEL: [MAP '%s'] Reloaded map data: %d object(s) added, %d removed, %d moved, %d chunk(s) changed",
+        map->name,
+        added,
+        removed,
+        moved,
+        changed_count
+    );
+    
+    return true;
+}
+
+/* 
+    파일 `file_path`의 변경을 감지하기 시작한다. Linux에서는 `inotify`로 파일이 있는 디렉토리를 
+    감시하며, 사용할 수 없다면 파일의 수정 시각을 비교한다. 변경된 내용은 `UpdateMapWatch()`를 
+    호출할 때 반영된다.
+*/
+bool WatchMapFile(LwMap *map, const char *file_path) {
+    LwMapWatch *watch;
+    
+    if (!FileExists(file_path))
+        return false;
+    
+    UnwatchMapFile(map);
+    
+    watch = (LwMapWatch *) RL_CALLOC(1, sizeof(LwMapWatch));
+    
+    watch->path = (char *) RL_CALLOC(MAX_STRING_LENGTH, sizeof(char));
+    
+    TextCopy(watch->path, file_path);
+    
+    watch->mod_time = GetFileModTime(file_path);
+    watch->fd = -1;
+    
+#ifdef LW_USE_INOTIFY
+    /* 편집기가 새 파일을 만든 다음 이름을 바꿔 저장할 수도 있으므로, 파일 대신 디렉토리를 감시한다. */
+    if ((watch->fd = inotify_init1(IN_NONBLOCK)) >= 0
+        && inotify_add_watch(watch->fd, GetDirectoryPath(file_path), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        close(watch->fd);
+        
+        watch->fd = -1;
+    }
+#endif
+    
+    map->_watch = watch;
+    
+    return true;
+}
+
+/* 
+    `WatchMapFile()`로 감시하는 게임 맵 파일이 바뀌었다면, `ReloadMap()`으로 바뀐 부분만 반영하고 
+    `true`를 반환한다. 매 프레임마다 호출해도 된다.
+*/
+bool UpdateMapWatch(LwMap *map) {
+    LwMapWatch *watch = map->_watch;
+    
+    long mod_time;
+    
+    bool changed = false;
+    
+    if (watch == NULL)
+        return false;
+    
+#ifdef LW_USE_INOTIFY
+    if (watch->fd >= 0) {
+        /* `inotify_event` 구조체를 읽을 수 있도록, 버퍼의 정렬을 구조체에 맞춘다. */
+        union {
+            struct inotify_event event;
+            char bytes[4096];
+        } buffer;
+        
+        const struct inotify_event *event;
+        
+        ssize_t length;
+        
+        while ((length = read(watch->fd, buffer.bytes, sizeof(buffer.bytes))) > 0) {
+            for (ssize_t offset = 0; offset < length; offset += sizeof(struct inotify_event) + event->len) {
+                event = (const struct inotify_event *) (buffer.bytes + offset);
+                
+                if (event->len > 0 && TextIsEqual(event->name, GetFileName(watch->path)))
+                    changed = true;
+            }
+        }
+        
+        if (!changed)
+            return false;
+    }
+#endif
+    
+    mod_time = GetFileModTime(watch->path);
+    
+    /* `inotify`를 사용할 수 없다면, 수정 시각이 바뀌었을 때만 다시 불러온다. */
+    if (!changed && mod_time == watch->mod_time)
+        return false;
+    
+    watch->mod_time = mod_time;
+    
+    return ReloadMap(map, watch->path);
+}
+
+/* 게임 맵 파일의 변경을 더 이상 감지하지 않는다. */
+void UnwatchMapFile(LwMap *map) {
+    if (map->_watch == NULL)
+        return;
+    
+#ifdef LW_USE_INOTIFY
+    if (map->_watch->fd >= 0)
+        close(map->_watch->fd);
+#endif
+    
+    RL_FREE(map->_watch->path);
+    RL_FREE(map->_watch);
+    
+    map->_watch = NULL;
+}
+
+/* 
+    위치 `position`을 기준으로 게임 맵을 화면에 그린다. 스크롤 비율이 `(1, 1)`이 아닌 레이어는 
+    비율에 맞게 옮겨진 위치에 그려진다.
+*/
+void DrawMap(LwMap *map, Vector2 position) {
+    for (int i = 0; i < MAX_LAYER_COUNT; i++)
+        DrawMapLayer(map, i, position, 1.0f);
+}
+
+/* 
+    위치 `position`을 기준으로, 확대 배율이 `zoom`인 화면에 게임 맵을 그린다. 화면에 그려지는 타일의 
+    크기가 `LOD_TILE_SIZE`보다 작다면, 화면을 채우는 데 충분한 가장 작은 축소 이미지를 대신 그린다.
+    축소 이미지는 `UpdateMapLod()`로 미리 만들어두어야 한다.
+*/
+void DrawMapEx(LwMap *map, Vector2 position, float zoom) {
+    for (int i = 0; i < MAX_LAYER_COUNT; i++)
+        DrawMapLayer(map, i, position, zoom);
+}
+
+/* 
+    위치 `position`을 기준으로, 확대 배율이 `zoom`인 화면에 보이는 청크 묶음의 축소 이미지 중에서 
+    아직 만들지 않았거나 바뀐 이미지를 만든다. 렌더 텍스처에 그림을 그려야 하므로, `BeginMode2D()`와 
+    `EndMode2D()` 사이에서는 호출하면 안 된다.
+*/
+void UpdateMapLod(LwMap *map, Vector2 position, float zoom) {
+    LwLodLevel *lod_level;
+    
+    int level, min_x, min_y, max_x, max_y;
+    
+    level = GetLodLevel(map, zoom);
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid || map->layers[i]._merged)
+            continue;
+        
+        InvalidateLayerLod(map, i);
+        
+        if (level == 0)
+            continue;
+        
+        lod_level = GetLayerLodLevel(map, i, level);
+        
+        GetLodGroupRange(
+            map, lod_level, level, 
+            GetLayerPosition(&map->layers[i], position), zoom, 
+            &min_x, &min_y, &max_x, &max_y
+        );
+        
+        for (int group_y = min_y; group_y <= max_y; group_y++)
+            for (int group_x = min_x; group_x <= max_x; group_x++)
+                BuildLodImage(map, i, level, group_x, group_y);
+    }
+}
+
+/* 
+    타일셋 이미지에서 구한 타일마다의 대표 색상으로 게임 맵의 미니맵 이미지를 만든다. 스크롤 비율이 
+    `(1, 1)`인 레이어의 타일셋 개체만 그리며, 위쪽 레이어의 불투명한 타일이 아래쪽 타일을 가린다. 
+    렌더 텍스처를 사용하지 않으므로, 창을 만들지 않고도 사용할 수 있다.
+*/
+bool LoadMinimap(LwMap *map, LwMinimap *minimap) {
+    if (map->layers == NULL || map->width.t <= 0 || map->height.t <= 0)
+        return false;
+    
+    *minimap = (LwMinimap) {
+        .image = (Image) {
+            .data = RL_CALLOC(map->width.t * map->height.t, sizeof(uint32_t)),
+            .width = map->width.t,
+            .height = map->height.t,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+        }
+    };
+    
+    minimap->_signatures = (uint64_t *) RL_CALLOC(map->width.c * map->height.c, sizeof(uint64_t));
+    
+    UpdateMinimap(map, minimap);
+    
+    TraceLog(
+        LOG_INFO, 
+        "LOWEL: [MAP '%s'] Generated %dx%d minimap",
+        map->name,
+        map->width.t,
+        map->height.t
+    );
+    
+    return true;
+}
+
+/* 미니맵을 마지막으로 만든 이후 바뀐 청크만 다시 그리고, 다시 그린 청크의 개수를 반환한다. */
+int UpdateMinimap(LwMap *map, LwMinimap *minimap) {
+    LwMinimapTask tasks[LW_MINIMAP_THREAD_COUNT];
+    LwObject *object;
+    
+    uint64_t signature;
+    
+    int *indexes;
+    
+    int count = 0, task_count;
+    
+    if (minimap->image.data == NULL || minimap->_signatures == NULL)
+        return 0;
+    
+    /* 스레드에서는 게임 맵과 개체의 데이터를 읽기만 하도록, 개체와 색상 표를 미리 불러온다. */
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!IsMinimapObject(&map->layers[i], object))
+                continue;
+            
+            if (!object->loaded)
+                LoadObject(map, object);
+            
+            LoadTileColors(map, object);
+        }
+    }
+    
+    indexes = (int *) RL_MALLOC(map->width.c * map->height.c * sizeof(int));
+    
+    for (int i = 0; i < (map->width.c * map->height.c); i++) {
+        if ((signature = GetMinimapSignature(map, i)) == minimap->_signatures[i])
+            continue;
+        
+        minimap->_signatures[i] = signature;
+        
+        indexes[count++] = i;
+    }
+    
+    task_count = (count >= LW_MINIMAP_BATCH_MIN) ? LW_MINIMAP_THREAD_COUNT : 1;
+    
+    for (int i = 0; i < task_count; i++)
+        tasks[i] = (LwMinimapTask) {
+            .map = map,
+            .minimap = minimap,
+            .indexes = indexes,
+            .begin = (int) (((long long) count * i) / task_count),
+            .end = (int) (((long long) count * (i + 1)) / task_count)
+        };
+    
+#ifndef LOWEL_NO_THREADS
+    {
+        pthread_t threads[LW_MINIMAP_THREAD_COUNT];
+        
+        bool started[LW_MINIMAP_THREAD_COUNT] = { false };
+        
+        /* 첫 번째 작업은 호출한 스레드에서 직접 처리한다. */
+        for (int i = 1; i < task_count; i++)
+            started[i] = (pthread_create(&threads[i], NULL, RunMinimapTask, &tasks[i]) == 0);
+        
+        RunMinimapTask(&tasks[0]);
+        
+        for (int i = 1; i < task_count; i++) {
+            if (started[i])
+                pthread_join(threads[i], NULL);
+            else
+                RunMinimapTask(&tasks[i]);
+        }
+    }
+#else
+    for (int i = 0; i < task_count; i++)
+        RunMinimapTask(&tasks[i]);
+#endif
+    
+    RL_FREE(indexes);
+    
+    return count;
+}
+
+/* 미니맵의 메모리를 해제한다. */
+void UnloadMinimap(LwMinimap *minimap) {
+    RL_FREE(minimap->image.data);
+    RL_FREE(minimap->_signatures);
+    
+    *minimap = (LwMinimap) { 0 };
+}
+
+/* 게임 맵 데이터를 파일에 저장한다. */
+bool SaveMap(LwMap *map, const char *file_path) {
+    LwObject *object;
+    
+    char *map_data;
+    
+    bool result;
+    
+    if (!SaveMapToMemory(map, &map_data))
+        return false;
+    
+    result = SaveFileText(file_path, map_data);
+    
+    free(map_data);
+    
+    if (!result)
+        return false;
+    
+    /* 게임 맵 전체를 저장했으므로, 이전의 저널 파일과 변경 사항 표시는 더 이상 필요하지 않다. */
+    if (FileExists(GetJournalPath(file_path)))
+        remove(GetJournalPath(file_path));
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid)
+                continue;
+            
+            object->dirty &= ~LW_DIRTY_SAVE;
+            
+            if (object->chunkset.chunks != NULL)
+                ClearDirtyChunks(object, LW_DIRTY_SAVE);
+        }
+    }
+    
+    return true;
+}
+
+/* 게임 맵 데이터를 메모리에 저장한다. */
+bool SaveMapToMemory(LwMap *map, char **map_data) {
+    JsonNode *node_root;
+    
+    node_root = json_mkobject();
+    
+    if (!SaveHeaderData(map, node_root)
+        || !SaveOptionsData(map, node_root)
+        || !SaveLayersData(map, node_root)) {
+        json_delete(node_root);
+        
+        return false;
+    }
+    
+    *map_data = json_encode(node_root);
+    
+    json_delete(node_root);
+    
+    return true;
+}
+
+/* 
+    마지막으로 저장한 이후 변경된 청크와 개체만 게임 맵 파일의 저널 파일 
+    (`file_path` + `.journal`)에 덧붙여 저장한다.
+*/
+bool SaveMapJournal(LwMap *map, const char *file_path) {
+    JsonNode *node_record, *node_objects, *node_chunks;
+    JsonNode *node_object, *node_position, *node_chunk, *node_tiledata;
+    
+    LwObject *object;
+    
+    FILE *journal_file;
+    
+    char *journal_data;
+    
+    int *chunk_buffer;
+    
+    int chunk_index;
+    
+    chunk_buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+    
+    node_record = json_mkobject();
+    
+    node_objects = json_mkarray();
+    node_chunks = json_mkarray();
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid)
+                continue;
+            
+            if (object->dirty & LW_DIRTY_SAVE) {
+                node_object = json_mkobject();
+                node_position = json_mkobject();
+                
+                json_append_member(node_position, "x", json_mknumber(object->position.x));
+                json_append_member(node_position, "y", json_mknumber(object->position.y));
+                
+                json_append_member(node_object, "id", json_mknumber(j));
+                json_append_member(node_object, "position", node_position);
+                
+                json_append_element(node_objects, node_object);
+            }
+            
+            if (!object->tileset || object->auto_split)
+                continue;
+            
+            for (int k = 0; k < object->chunkset.dirty_count; k++) {
+                chunk_index = object->chunkset.dirty_indexes[k];
+                
+                if (!(object->chunkset.chunks[chunk_index].dirty & LW_DIRTY_SAVE))
+                    continue;
+                
+                node_chunk = json_mkobject();
+                node_tiledata = SaveChunkData(map, object, chunk_index, chunk_buffer);
+                
+                json_append_member(node_chunk, "object", json_mknumber(j));
+                json_append_member(node_chunk, "index", json_mknumber(chunk_index));
+                json_append_member(node_chunk, "tiledata", node_tiledata);
+                
+                json_append_element(node_chunks, node_chunk);
+            }
+        }
+    }
+    
+    RL_FREE(chunk_buffer);
+    
+    if (json_first_child(node_objects) == NULL && json_first_child(node_chunks) == NULL) {
+        json_delete(node_objects);
+        json_delete(node_chunks);
+        json_delete(node_record);
+        
+        return true;
+    }
+    
+    json_append_member(node_record, "objects", node_objects);
+    json_append_member(node_record, "chunks", node_chunks);
+    
+    journal_data = json_encode(node_record);
+    
+    json_delete(node_record);
+    
+    /* 변경 사항 하나는 저널 파일의 한 줄에 해당한다. */
+    if ((journal_file = fopen(GetJournalPath(file_path), "ab")) == NULL) {
+        free(journal_data);
+        
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to open journal file",
+            map->name
+        );
+        
+        return false;
+    }
+    
+    fprintf(journal_file, "%s\n", journal_data);
+    fclose(journal_file);
+    
+    free(journal_data);
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid)
+                continue;
+            
+            object->dirty &= ~LW_DIRTY_SAVE;
+            
+            if (object->chunkset.chunks != NULL)
+                ClearDirtyChunks(object, LW_DIRTY_SAVE);
+        }
+    }
+    
+    return true;
+}
+
+/* 게임 맵의 저널 파일에 기록된 변경 사항을 게임 맵 파일에 합친 다음, 저널 파일을 삭제한다. */
+bool CompactMapJournal(LwMap *map, const char *file_path) {
+    return SaveMap(map, file_path);
+}
+
+/* 게임 맵 데이터의 메모리를 해제한다. */
+void UnloadMap(LwMap *map) {
+    LwObject *object;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            if (!map->layers[i].objects[j]._valid)
+                continue;
+                
+            object = &map->layers[i].objects[j];
+            
+            UnloadObjectData(object);
+            
+            TraceLog(
+                LOG_INFO, 
+                "LOWEL: [MAP '%s'] Unloaded object #%d",
+                map->name,
+                j
+            );
+        }
+        
+        if (map->layers[i]._baked != NULL) {
+            for (int j = 0; j < (map->width.c * map->height.c); j++) {
+                if (!map->layers[i]._baked[j]._valid)
+                    continue;
+                
+                UnloadRenderTexture(map->layers[i]._baked[j].target);
+            }
+            
+            RL_FREE(map->layers[i]._baked);
+        }
+        
+        for (int j = 0; j < map->layers[i]._lod_count; j++) {
+            if (map->layers[i]._lod[j].images == NULL)
+                continue;
+            
+            for (int k = 0; k < (map->layers[i]._lod[j].width * map->layers[i]._lod[j].height); k++)
+                if (map->layers[i]._lod[j].images[k].target.id)
+                    UnloadRenderTexture(map->layers[i]._lod[j].images[k].target);
+            
+            RL_FREE(map->layers[i]._lod[j].images);
+        }
+        
+        RL_FREE(map->layers[i]._lod);
+        
+        TraceLog(
+            LOG_INFO, 
+            "LOWEL: [MAP '%s'] Unloaded layer #%d",
+            map->name,
+            i
+        );
+    }
+    
+    UnloadFog(map);
+    UnloadLights(map);
+    UnwatchMapFile(map);
+    UnloadPathGraph(map);
+    
+    if (map->_pool != NULL)
+        RL_FREE(map->_pool->objects);
+    
+    RL_FREE(map->_pool);
+    RL_FREE(map->_solid);
+    RL_FREE(map->_source);
+    RL_FREE(map->object_table);
+    RL_FREE(map->layers);
+    RL_FREE(map->name);
+    
+    /* 같은 구조체로 게임 맵을 다시 불러올 수 있도록, 설정을 제외한 모든 값을 초기화한다. */
+    *map = (LwMap) {
+        .compression = map->compression,
+        .lazy_load = map->lazy_load,
+        .load_texture = map->load_texture
+    };
+    
+    TraceLog(
+        LOG_INFO, 
+        "LOWEL: Unloaded map data successfully"
+    );
+}
+
+/* ::: 개체 관련 함수 ::: */
+
+/* 고유 번호가 `index`인 개체의 메모리 주소를 반환한다. */
+LwObject *GetObject(LwMap *map, int index) {
+    int layer_id;
+    
+    if (index < 0 || index > MAX_OBJECT_COUNT - 1)
+        return NULL;
+    
+    layer_id = map->object_table[index];
+    
+    if (!map->layers[layer_id]._valid || map->layers[layer_id].objects == NULL
+        || !map->layers[layer_id].objects[index]._valid)
+        return NULL;
+    
+    return &map->layers[layer_id].objects[index];
+}
+
+/* 핸들 `handle`이 가리키는 개체의 메모리 주소를 반환한다. 이미 제거된 개체라면 `NULL`을 반환한다. */
+LwObject *GetObjectByHandle(LwMap *map, LwObjectHandle handle) {
+    int index = (int) (handle & 0xFFFF);
+    
+    if (map->_pool == NULL || index > MAX_OBJECT_COUNT - 1
+        || map->_pool->generations[index] != (handle >> 16))
+        return NULL;
+    
+    return GetObject(map, index);
+}
+
+/* 개체 `object`를 가리키는 핸들을 반환한다. */
+LwObjectHandle GetObjectHandle(LwMap *map, LwObject *object) {
+    if (map->_pool == NULL || object == NULL || !object->_valid)
+        return LW_NULL_HANDLE;
+    
+    return ((LwObjectHandle) map->_pool->generations[object->id] << 16) 
+        | (LwObjectHandle) object->id;
+}
+
+/* 
+    고유 번호가 `layer_id`인 레이어에 이미지 파일의 경로가 `image_path`인 개체를 위치 `position`에 
+    새로 만들고, 그 개체를 가리키는 핸들을 반환한다. 사용할 수 있는 고유 번호가 없다면 
+    `LW_NULL_HANDLE`을 반환한다.
+*/
+LwObjectHandle CreateObject(LwMap *map, int layer_id, const char *image_path, Vector2 position) {
+    LwObject *object, *other;
+    
+    int object_id;
+    
+    if (map->_pool == NULL || layer_id < 0 || layer_id > MAX_LAYER_COUNT - 1)
+        return LW_NULL_HANDLE;
+    
+    if (map->_pool->free_count <= 0) {
+        TraceLog(
+            LOG_WARNING, 
+            "LOWEL: [MAP '%s'] Unable to create object: too many objects",
+            map->name
+        );
+        
+        return LW_NULL_HANDLE;
+    }
+    
+    InitLayer(map, layer_id);
+    
+    object_id = map->_pool->free_ids[--map->_pool->free_count];
+    
+    map->object_table[object_id] = layer_id;
+    
+    object = &map->layers[layer_id].objects[object_id];
+    
+    *object = (LwObject) {
+        ._valid = true,
+        .id = object_id,
+        .scale = 1.0,
+        .position = position,
+        .dirty = LW_DIRTY_SAVE,
+        .loaded = true,
+        .tiledata_offset = -1
+    };
+    
+    object->image_path = (char *) RL_CALLOC(MAX_STRING_LENGTH, sizeof(char));
+    
+    TextCopy(object->image_path, image_path);
+    
+    /* 같은 이미지를 사용하는 개체가 이미 있다면, 그 개체의 텍스처를 함께 사용한다. */
+    for (int i = 0; i < MAX_LAYER_COUNT && !object->texture.id; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            other = &map->layers[i].objects[j];
+            
+            if (other->texture.id && TextIsEqual(other->image_path, image_path)) {
+                object->texture = other->texture;
+                
+                break;
+            }
+        }
+    }
+    
+    if (!object->texture.id && map->load_texture != NULL)
+        object->texture = map->load_texture(object->image_path);
+    
+    if (!object->texture.id)
+        ReadImageSize(object->image_path, &object->image_width, &object->image_height);
+    
+    UpdateObjectSize(map, object);
+    
+    LinkObject(&map->layers[layer_id], object_id, false);
+    
+    return GetObjectHandle(map, object);
+}
+
+/* 핸들 `handle`이 가리키는 개체를 제거하고, 그 개체의 고유 번호를 다시 사용할 수 있도록 한다. */
+bool DestroyObject(LwMap *map, LwObjectHandle handle) {
+    LwObject *object;
+    
+    int layer_id;
+    
+    bool solid, opaque;
+    
+    if ((object = GetObjectByHandle(map, handle)) == NULL)
+        return false;
+    
+    layer_id = map->object_table[object->id];
+    
+    /* 축소 이미지에 그려진 개체라면, 그 레이어의 축소 이미지를 모두 다시 만든다. */
+    if (IsLodObject(&map->layers[GetLodLayerId(map, layer_id)], object))
+        ResetLayerLod(map, layer_id);
+    
+    UnlinkObject(&map->layers[layer_id], object->id);
+    
+    /* 이전 핸들로는 더 이상 개체에 접근할 수 없도록 세대 번호를 증가시킨다. */
+    if (++map->_pool->generations[object->id] == 0)
+        map->_pool->generations[object->id] = 1;
+    
+    map->_pool->free_ids[map->_pool->free_count++] = object->id;
+    
+    solid = HasSolidTiles(object);
+    opaque = HasOpaqueTiles(object);
+    
+    UnloadObjectData(object);
+    
+    *object = (LwObject) { ._prev = -1, ._next = -1 };
+    
+    if (solid)
+        BuildCollisionGrid(map);
+    
+    if (opaque)
+        RebuildLight(map);
+    
+    return true;
+}
+
+/* 
+    개체 `object`의 텍스처와 타일 데이터를 불러온다. `map.lazy_load`가 `true`일 때, 개체를 그리기 
+    전에 미리 불러오고 싶다면 이 함수를 호출하면 된다. 이미 불러온 개체라면 아무 것도 하지 않는다.
+*/
+bool LoadObject(LwMap *map, LwObject *object) {
+    if (object == NULL || !object->_valid)
+        return false;
+    
+    if (object->loaded)
+        return true;
+    
+    object->loaded = true;
+    
+    if (map->load_texture != NULL && object->image_path != NULL) {
+        TraceLog(
+            LOG_INFO, 
+            "LOWEL: [MAP '%s': %s] Attempting to load texture for object #%d",
+            map->name,
+            object->image_path,
+            object->id
+        );
+        
+        object->texture = map->load_texture(object->image_path);
+        
+        UpdateObjectSize(map, object);
+    }
+    
+    return LoadObjectTileData(map, object);
+}
+
+/* 개체 `object`의 텍스처와 타일 데이터를 이미 불러왔는지 확인한다. */
+bool IsObjectLoaded(LwObject *object) {
+    return object->loaded;
+}
+
+/* 개체의 현재 위치를 반환한다. */
+Vector2 GetObjectPosition(LwObject *object) {
+    return object->position;
+}
+
+/* 개체 이미지의 가로 길이를 반환한다. */
+double GetObjectWidth(LwObject *object) {
+    if (!object->_valid)
+        return 0;
+    
+    return object->image_width * object->scale; 
+}
+
+/* 개체 이미지의 세로 길이를 반환한다. */
+double GetObjectHeight(LwObject *object) {
+    if (!object->_valid)
+        return 0;
+    
+    return object->image_height * object->scale;
+}
+
+/* 개체의 현재 위치를 `position`으로 변경한다. */
+void SetObjectPosition(LwObject *object, Vector2 position) {
+    object->position = position;
+    
+    object->dirty |= LW_DIRTY_SAVE;
+}
+
+/* ::: 청크 관련 함수 ::: */
+
+/* 
+    게임 맵 또는 개체 텍스처에서 고유 번호가 `index`인 청크를 게임 화면에 그린다. 전장의 안개가 있다면, 
+    게임 맵의 청크에서 본 적이 없는 타일은 그리지 않는다.
+*/
+void DrawChunk(LwMap *map, LwObject *object, int index) {
+    int explored_count;
+    
+    if (index < 0 || !object->chunkset.chunks[index]._valid)
+        return;
+    
+    if (!object->tileset || object->auto_split) {
+        DrawChunkTiles(map, object, index, NULL);
+        
+        return;
+    }
+    
+    /* 본 적이 없는 청크는 타일을 하나씩 확인하지 않고 건너뛴다. */
+    if ((explored_count = GetExploredTileCount(map, index)) == 0)
+        return;
+    
+    DrawChunkTiles(
+        map, object, index, 
+        (explored_count < map->chunk_width * map->chunk_height) 
+            ? &map->_fog->explored[index * map->_fog->chunk_words] 
+            : NULL
+    );
+}
+
+/* 위치 `position`의 주변에 있는 청크를 모두 로드한다. */
+void LoadChunks(LwMap *map, LwObject *object, Vector2 position) {
+    int chunk_index;
+    
+    if (!object->loaded)
+        LoadObject(map, object);
+    
+    if (object->chunkset.chunks == NULL)
+        return;
+    
+    chunk_index = (object->tileset && !object->auto_split)
+        ? PositionToChunkIndexMap(map, position)
+        : PositionToChunkIndexObject(map, object, position);
+        
+    if (chunk_index >= 0) {
+        UpdateAdjacentChunkIndexes(map, object, chunk_index);
+
+        for (int adjacent_index = 0; adjacent_index < GetAdjacentChunkCount(map); adjacent_index++)
+            DrawChunk(map, object, object->chunkset.indexes[adjacent_index]);
+    }
+}
+
+/* 거리가 `map.draw_distance` 이하인 청크의 최대 개수를 구한다. */
+int GetAdjacentChunkCount(LwMap *map) {
+    return (2 * map->draw_distance + 1) * (2 * map->draw_distance + 1);
+}
+
+/* 
+    고유 번호가 `index`인 청크에서 거리가 `map.draw_distance` 이하인 청크의 고유 번호를 최대 
+    `max_count`개까지 `indexes`에 저장하고, 그러한 청크의 개수를 반환한다. 개체의 데이터는 
+    변경하지 않으므로 여러 스레드에서 동시에 호출할 수 있다.
+*/
+int GetAdjacentChunkIndexes(LwMap *map, LwObject *object, int index, int *indexes, int max_count) {
+    int adjacent_count = 0;
+    int adjacent_chunk_x, adjacent_chunk_y;
+    
+    for (int dy = (map->draw_distance); dy >= -(map->draw_distance); dy--) {
+        for (int dx = (map->draw_distance); dx >= -(map->draw_distance); dx--) {
+            if (adjacent_count > max_count - 1)
+                return adjacent_count;
+            
+            if (object->tileset && !object->auto_split) {
+                adjacent_chunk_x = GetMapChunkX(map, index) - dx;
+                adjacent_chunk_y = GetMapChunkY(map, index) - dy;
+
+                if (adjacent_chunk_x < 0 || adjacent_chunk_x > map->width.c - 1
+                   || adjacent_chunk_y < 0 || adjacent_chunk_y > map->height.c - 1)
+                    continue;
+
+                indexes[adjacent_count++] = (adjacent_chunk_y * map->width.c) + adjacent_chunk_x;
+            } else {
+                adjacent_chunk_x = GetObjectChunkX(object, index) - dx;
+                adjacent_chunk_y = GetObjectChunkY(object, index) - dy;
+
+                if (adjacent_chunk_x < 0 || adjacent_chunk_x > object->width.c - 1
+                   || adjacent_chunk_y < 0 || adjacent_chunk_y > object->height.c - 1)
+                    continue;
+
+                indexes[adjacent_count++] = (adjacent_chunk_y * object->width.c) + adjacent_chunk_x;
+            }
+        }
+    }
+    
+    return adjacent_count;
+}
+
+/* 
+    고유 번호가 `index`인 청크에서 거리가 `map.draw_distance` 이하인 모든 청크의 고유 번호를 
+    구한 다음, `object.chunk_indexes`에 저장한다.
+*/
+void UpdateAdjacentChunkIndexes(LwMap *map, LwObject *object, int index) {
+    int adjacent_index;
+    
+    if (object->chunkset.temp_index == index)
+        return;
+        
+    object->chunkset.temp_index = index;
+    
+    adjacent_index = GetAdjacentChunkIndexes(
+        map, object, index, 
+        object->chunkset.indexes, GetAdjacentChunkCount(map)
+    );
+    
+    /* 게임 맵의 가장자리에서는 그릴 청크의 개수가 줄어들므로, 남는 칸은 `-1`로 채운다. */
+    for (; adjacent_index < GetAdjacentChunkCount(map); adjacent_index++)
+        object->chunkset.indexes[adjacent_index] = -1;
+}
+
+/* 
+    위치 `position`에서 `map.draw_distance + 1`보다 멀리 떨어진 청크의 타일 데이터를 모두 압축하고,
+    압축된 청크의 개수를 반환한다. 압축된 청크는 다시 그려지거나 수정될 때 자동으로 압축이 풀린다.
+    거리는 레이어마다 스크롤 비율로 환산된 위치를 기준으로 잰다.
+*/
+int PackColdChunks(LwMap *map, Vector2 position) {
+    LwObject *object;
+    LwChunk *chunk;
+    
+    LwCompression compression;
+    
+    Vector2 layer_position;
+    
+    int center_index, center_x, center_y, width_c;
+    int count = 0;
+    
+    compression = (map->compression != LW_COMPRESSION_NONE)
+        ? map->compression
+        : LW_COMPRESSION_LZ;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        /* 스크롤 비율이 다른 레이어는 그려지는 청크도 다르므로, 레이어 기준 위치로 환산해서 확인한다. */
+        layer_position = GetLayerPosition(&map->layers[i], position);
+        
+        for (int j = map->layers[i]._first_object; 
+             j >= 0; 
+             j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            if (!object->_valid || object->chunkset.chunks == NULL)
+                continue;
+            
+            if (object->tileset && !object->auto_split) {
+                center_index = PositionToChunkIndexMap(map, layer_position);
+                width_c = map->width.c;
+            } else {
+                center_index = PositionToChunkIndexObject(map, object, layer_position);
+                width_c = object->width.c;
+            }
+            
+            if (center_index < 0)
+                continue;
+            
+            center_x = center_index % width_c;
+            center_y = center_index / width_c;
+            
+            for (int k = 0; k < object->chunkset.count; k++) {
+                chunk = &object->chunkset.chunks[k];
+                
+                if (chunk->data == NULL)
+                    continue;
+                
+                if (abs((k % width_c) - center_x) <= map->draw_distance + 1
+                    && abs((k / width_c) - center_y) <= map->draw_distance + 1)
+                    continue;
+                
+                chunk->packed = PackTileData(
+                    chunk->data, 
+                    map->chunk_width * map->chunk_height, 
+                    compression, 
+                    &chunk->packed_size
+                );
+                
+                RL_FREE(chunk->data);
+                
+                chunk->data = NULL;
+                
+                count++;
+            }
+        }
+    }
+    
+    return count;
+}
+
+/* 게임 맵에서 고유 번호가 `index`인 청크의 청크 기준 X좌표를 반환한다. */
+int GetMapChunkX(LwMap *map, int index) {
+    return FloorModulo(index, map->width.c, map->_width_shift.c);
+}
+
+/* 게임 맵에서 고유 번호가 `index`인 청크의 청크 기준 Y좌표를 반환한다. */
+int GetMapChunkY(LwMap *map, int index) {
+    return FloorDivide(index, map->width.c, map->_width_shift.c);
+}
+
+/* 게임 맵에서 고유 번호가 `index`인 타일의 타일 기준 X좌표를 반환한다. */
+int GetMapTileX(LwMap *map, int index) {
+    return FloorModulo(index, map->width.t, map->_width_shift.t);
+}
+
+/* 게임 맵에서 고유 번호가 `index`인 타일의 타일 기준 Y좌표를 반환한다. */
+int GetMapTileY(LwMap *map, int index) {
+    return FloorDivide(index, map->width.t, map->_width_shift.t);
+}
+
+/* 개체 텍스처에서 고유 번호가 `index`인 청크의 청크 기준 X좌표를 반환한다. */
+int GetObjectChunkX(LwObject *object, int index) {
+    return FloorModulo(index, object->width.c, object->width_shift.c);
+}
+
+/* 개체 텍스처에서 고유 번호가 `index`인 청크의 청크 기준 Y좌표를 반환한다. */
+int GetObjectChunkY(LwObject *object, int index) {
+    return FloorDivide(index, object->width.c, object->width_shift.c);
+}
+
+/* 개체 텍스처에서 고유 번호가 `index`인 타일의 타일 기준 X좌표를 반환한다. */
+int GetObjectTileX(LwObject *object, int index) {
+    return FloorModulo(index, object->width.t, object->width_shift.t);
+}
+
+/* 개체 텍스처에서 고유 번호가 `index`인 타일의 타일 기준 Y좌표를 반환한다. */
+int GetObjectTileY(LwObject *object, int index) {
+    return FloorDivide(index, object->width.t, object->width_shift.t);
+}
+
+/* 게임 맵에서 고유 번호가 `index`인 청크의 시작 위치를 구한다. */
+Vector2 ChunkIndexToPositionMap(LwMap *map, int index) {
+    return (Vector2) { 
+        GetMapChunkX(map, index) * (map->chunk_width * map->tile_width),
+        GetMapChunkY(map, index) * (map->chunk_height * map->tile_height)
+    };
+}
+
+/* 개체 텍스처에서 고유 번호가 `index`인 청크의 시작 위치를 구한다. */
+Vector2 ChunkIndexToPositionObject(LwMap *map, LwObject *object, int index) {
+    return (Vector2) { 
+        object->position.x + (GetObjectChunkX(object, index) * (map->chunk_width * map->tile_width)),
+        object->position.y + (GetObjectChunkY(object, index) * (map->chunk_height * map->tile_height))
+    };
+}
+
+/* 게임 맵에서 위치 `position`이 속한 청크의 인덱스를 구한다. */
+int PositionToChunkIndexMap(LwMap *map, Vector2 position) {
+    int tile_index;
+    
+    if ((tile_index = PositionToTileIndexMap(map, position)) < 0)
+        return -1;
+    
+    return TileIndexToChunkIndexMap(map, tile_index);
+}
+
+/* 개체 텍스처에서 위치 `position`이 속한 청크의 인덱스를 구한다. */
+int PositionToChunkIndexObject(LwMap *map, LwObject *object, Vector2 position) {
+    int tile_index;
+    
+    if ((tile_index = PositionToTileIndexObject(map, object, position)) < 0)
+        return -1;
+    
+    return TileIndexToChunkIndexObject(map, object, tile_index);
+}
+
+/* 
+    게임 맵에서 위치 `position`이 속한 타일의 인덱스를 구한다. 게임 맵을 벗어난 위치는 
+    가장 가까운 가장자리의 타일로 옮겨서 계산한다.
+*/
+int PositionToTileIndexMap(LwMap *map, Vector2 position) {
+    LwTileCoord coord = PositionToTileCoordMap(map, position);
+    
+    coord.x = LW_MIN(LW_MAX(coord.x, 0), map->width.t - 1);
+    coord.y = LW_MIN(LW_MAX(coord.y, 0), map->height.t - 1);
+    
+    return (coord.y * map->width.t) + coord.x;
+}
+
+/* 
+    개체 텍스처에서 위치 `position`이 속한 타일의 인덱스를 구한다. 개체 텍스처를 벗어난 위치는 
+    가장 가까운 가장자리의 타일로 옮겨서 계산한다.
+*/
+int PositionToTileIndexObject(LwMap *map, LwObject *object, Vector2 position) {
+    LwTileCoord coord;
+    
+    if (object->width.t <= 0 || object->height.t <= 0)
+        return -1;
+    
+    coord = PositionToTileCoordObject(map, object, position);
+    
+    coord.x = LW_MIN(LW_MAX(coord.x, 0), object->width.t - 1);
+    coord.y = LW_MIN(LW_MAX(coord.y, 0), object->height.t - 1);
+    
+    return (coord.y * object->width.t) + coord.x;
+}
+
+/* 
+    게임 맵에서 위치 `position`이 속한 타일의 타일 기준 좌표를 구한다. 
+    게임 맵을 벗어난 위치나 음수 위치도 내림하여 계산한다.
+*/
+LwTileCoord PositionToTileCoordMap(LwMap *map, Vector2 position) {
+    return (LwTileCoord) {
+        FloorDivide((int) floorf(position.x), map->tile_width, map->_shift.tile_width),
+        FloorDivide((int) floorf(position.y), map->tile_height, map->_shift.tile_height)
+    };
+}
+
+/* 
+    개체 텍스처에서 위치 `position`이 속한 타일의 타일 기준 좌표를 구한다.
+    개체 텍스처를 벗어난 위치나 음수 위치도 내림하여 계산한다.
+*/
+LwTileCoord PositionToTileCoordObject(LwMap *map, LwObject *object, Vector2 position) {
+    return PositionToTileCoordMap(
+        map, 
+        (Vector2) { position.x - object->position.x, position.y - object->position.y }
+    );
+}
+
+/* 타일 기준 좌표가 `coord`인 타일이 속한 청크의 청크 기준 좌표를 구한다. */
+LwChunkCoord TileCoordToChunkCoord(LwMap *map, LwTileCoord coord) {
+    return TileXYToChunkCoord(map, coord.x, coord.y);
+}
+
+/* 게임 맵에서 타일 기준 좌표가 `coord`인 타일의 시작 위치를 구한다. */
+Vector2 TileCoordToPositionMap(LwMap *map, LwTileCoord coord) {
+    return (Vector2) {
+        coord.x * map->tile_width,
+        coord.y * map->tile_height
+    };
+}
+
+/* 개체 텍스처에서 타일 기준 좌표가 `coord`인 타일의 시작 위치를 구한다. */
+Vector2 TileCoordToPositionObject(LwMap *map, LwObject *object, LwTileCoord coord) {
+    return (Vector2) {
+        object->position.x + (coord.x * map->tile_width),
+        object->position.y + (coord.y * map->tile_height)
+    };
+}
+
+/* 게임 맵에서 고유 번호가 `chunk_index`인 청크의 `relative_tile_index + 1`번째 타일의 시작 위치를 구한다. */
+Vector2 RelativeTileIndexToPositionMap(
+    LwMap *map, 
+    int chunk_index, int relative_tile_index
+) {
+    Vector2 chunk_position = ChunkIndexToPositionMap(map, chunk_index);
+    
+    return (Vector2) {
+        chunk_position.x + (FloorModulo(relative_tile_index, map->chunk_width, map->_shift.chunk_width) 
+            * map->tile_width),
+        chunk_position.y + (FloorDivide(relative_tile_index, map->chunk_width, map->_shift.chunk_width) 
+            * map->tile_height)
+    };
+}
+
+/* 개체 텍스처에서 고유 번호가 `chunk_index`인 청크의 `relative_tile_index + 1`번째 타일의 시작 위치를 구한다. */
+Vector2 RelativeTileIndexToPositionObject(
+    LwMap *map, LwObject *object, 
+    int chunk_index, int relative_tile_index
+) {
+    Vector2 chunk_position = ChunkIndexToPositionObject(map, object, chunk_index);
+    
+    return (Vector2) {
+        chunk_position.x + (FloorModulo(relative_tile_index, map->chunk_width, map->_shift.chunk_width) 
+            * map->tile_width),
+        chunk_position.y + (FloorDivide(relative_tile_index, map->chunk_width, map->_shift.chunk_width) 
+            * map->tile_height)
+    };
+}
+
+/* 고유 번호가 `index`인 타일이 속한 청크의 인덱스를 구한다. */
+int TileIndexToChunkIndexMap(LwMap *map, int index) {
+    LwChunkCoord chunk = TileXYToChunkCoord(map, GetMapTileX(map, index), GetMapTileY(map, index));
+    
+    return (chunk.y * map->width.c) + chunk.x;
+}
+
+/* 고유 번호가 `index`인 타일이 속한 청크의 인덱스를 구한다. */
+int TileIndexToChunkIndexObject(LwMap *map, LwObject *object, int index) {
+    LwChunkCoord chunk = TileXYToChunkCoord(
+        map, 
+        GetObjectTileX(object, index), GetObjectTileY(object, index)
+    );
+    
+    return (chunk.y * object->width.c) + chunk.x;
+}
+
+/* 고유 번호가 `index`인 타일의 시작 위치를 구한다. */
+Vector2 TileIndexToPositionMap(LwMap *map, int index) {
+    return (Vector2) {
+        GetMapTileX(map, index) * map->tile_width,
+        GetMapTileY(map, index) * map->tile_height
+    };
+}
+
+/* 고유 번호가 `index`인 타일의 시작 위치를 구한다. */
+Vector2 TileIndexToPositionObject(LwMap *map, LwObject *object, int index) {
+    return (Vector2) {
+        object->position.x + (GetObjectTileX(object, index) * map->tile_width),
+        object->position.y + (GetObjectTileY(object, index) * map->tile_height)
+    };
+}
+
+/* ::: 타일 관련 함수 ::: */
+
+/* 개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 고유 번호를 반환한다. */
+int GetTile(LwMap *map, LwObject *object, int tile_x, int tile_y) {
+    int chunk_index, relative_tile_index;
+    
+    if (!object->loaded)
+        LoadObject(map, object);
+    
+    if (!object->tileset || object->auto_split || object->chunkset.chunks == NULL)
+        return -1;
+    
+    if (tile_x < 0 || tile_x > map->width.t - 1
+        || tile_y < 0 || tile_y > map->height.t - 1)
+        return -1;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    return GetChunkData(map, object, chunk_index)[relative_tile_index];
+}
+
+/* 
+    개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 지형 고유 번호를 반환한다. 
+    자동 타일이 아니라면 `GetTile()`과 같은 값을 반환한다.
+*/
+int GetTerrain(LwMap *map, LwObject *object, int tile_x, int tile_y) {
+    return GetTerrainId(object, GetTile(map, object, tile_x, tile_y));
+}
+
+/* 
+    게임 맵 `map`의 타일을 여러 스레드에서 동시에 읽을 때 사용할 컨텍스트를 만든다. 
+    컨텍스트는 스레드마다 하나씩 만들어야 하며, 게임 맵의 청크 크기가 바뀌면 다시 만들어야 한다.
+*/
+LwQueryContext *LoadQueryContext(LwMap *map) {
+    LwQueryContext *context = (LwQueryContext *) RL_CALLOC(1, sizeof(LwQueryContext));
+    
+    context->map = map;
+    context->buffer_index = -1;
+    
+    context->buffer = (int *) RL_MALLOC(map->chunk_width * map->chunk_height * sizeof(int));
+    
+    return context;
+}
+
+/* 읽기 컨텍스트의 메모리를 해제한다. */
+void UnloadQueryContext(LwQueryContext *context) {
+    if (context == NULL)
+        return;
+    
+    RL_FREE(context->buffer);
+    RL_FREE(context);
+}
+
+/* 
+    컨텍스트 `context`를 사용하여 개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 
+    고유 번호를 반환한다. `GetTile()`과 달리 개체나 청크를 불러오거나 압축을 풀어두지 않으므로, 
+    게임 맵을 변경하는 스레드가 없다면 여러 스레드에서 동시에 호출할 수 있다. 
+    아직 불러오지 않은 개체라면 `-1`을 반환한다.
+*/
+int QueryTile(LwQueryContext *context, LwObject *object, int tile_x, int tile_y) {
+    LwMap *map = context->map;
+    
+    int chunk_index, relative_tile_index;
+    
+    if (!object->loaded || !object->tileset || object->auto_split || object->chunkset.chunks == NULL)
+        return -1;
+    
+    if (tile_x < 0 || tile_x > map->width.t - 1
+        || tile_y < 0 || tile_y > map->height.t - 1)
+        return -1;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    return PeekQueryChunkData(context, object, chunk_index)[relative_tile_index];
+}
+
+/* 
+    컨텍스트 `context`를 사용하여 개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 
+    지형 고유 번호를 반환한다. `QueryTile()`과 마찬가지로 여러 스레드에서 동시에 호출할 수 있다.
+*/
+int QueryTerrain(LwQueryContext *context, LwObject *object, int tile_x, int tile_y) {
+    return GetTerrainId(object, QueryTile(context, object, tile_x, tile_y));
+}
+
+/* 
+    개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일의 고유 번호를 `tile_id`로 
+    변경하고, 그 타일이 속한 청크를 변경된 청크로 표시한다. `tile_id`가 자동 타일의 지형이라면, 
+    그 타일과 주변 8칸의 타일만 지형에 맞게 다시 고른다. 지형에서 그리는 타일의 고유 번호라면 
+    직접 놓은 타일로 취급하며, 주변 타일이 바뀌어도 다시 고르지 않는다.
+*/
+bool SetTile(LwMap *map, LwObject *object, int tile_x, int tile_y, int tile_id) {
+    LwChunk *chunk;
+    
+    int *chunk_data;
+    
+    int chunk_index, relative_tile_index, previous_tile_id;
+    
+    if (!object->loaded)
+        LoadObject(map, object);
+    
+    if (!object->tileset || object->auto_split || object->chunkset.chunks == NULL)
+        return false;
+    
+    if (tile_x < 0 || tile_x > map->width.t - 1
+        || tile_y < 0 || tile_y > map->height.t - 1)
+        return false;
+    
+    chunk_index = TileXYToChunkIndex(
+        map, map->width.c, 
+        tile_x, tile_y, 
+        &relative_tile_index
+    );
+    
+    chunk = &object->chunkset.chunks[chunk_index];
+    chunk_data = GetChunkData(map, object, chunk_index);
+    
+    if (tile_id < 0)
+        tile_id = -1;
+    
+    /* 라이브러리가 고른 자동 타일은 그리는 타일이 아닌 지형이 같은지를 확인한다. */
+    previous_tile_id = chunk_data[relative_tile_index];
+    
+    if (GetStoredTileId(object, chunk_index, relative_tile_index, previous_tile_id) == tile_id)
+        return true;
+    
+    chunk_data[relative_tile_index] = tile_id;
+    
+    if (chunk->_autotiled != NULL)
+        chunk->_autotiled[relative_tile_index] = false;
+    
+    if (tile_id >= 0)
+        chunk->_valid = true;
+    
+    if (IsAnimatedTileId(object, previous_tile_id) || IsAnimatedTileId(object, tile_id))
+        UpdateAnimatedTiles(map, object, chunk_index, chunk_data);
+    
+    /* 충돌 판정이 없는 개체의 타일은 경로 탐색에 영향을 주지 않는다. */
+    MarkChunkDirty(
+        map, object, chunk_index, 
+        HasSolidTiles(object) ? LW_DIRTY_ALL : (LW_DIRTY_ALL & ~LW_DIRTY_PATH)
+    );
+    
+    if (object->solid_tiles != NULL)
+        UpdateSolidTile(map, tile_x, tile_y);
+    
+    if (object->opaque_tiles != NULL)
+        UpdateLightTile(map, tile_x, tile_y);
+    
+    /* 바뀐 타일과 그 주변 8칸의 자동 타일만 다시 고른다. */
+    ResolveAutotileRect(
+        map, object, 
+        tile_x - 1, tile_y - 1, tile_x + 1, tile_y + 1, 
+        HasSolidTiles(object) 
+            ? (LW_DIRTY_RENDER | LW_DIRTY_LOD | LW_DIRTY_PATH) 
+            : (LW_DIRTY_RENDER | LW_DIRTY_LOD)
+    );
+    
+    return true;
+}
+
+/* 
+    개체 `object`에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일부터 가로 `width`개, 
+    세로 `height`개의 타일을 모두 `tile_id`로 변경하고, 변경된 타일의 개수를 반환한다.
+*/
+int FillTileRect(
+    LwMap *map, LwObject *object, 
+    int tile_x, int tile_y, 
+    int width, int height, 
+    int tile_id
+) {
+    int min_x, min_y, max_x, max_y;
+    int chunk_index, relative_tile_index, previous_tile_id;
+    int count = 0;
+    
+    if (!object->loaded)
+        LoadObject(map, object);
+    
+    if (!object->tileset || object->auto_split || object->chunkset.chunks == NULL)
+        return 0;
+    
+    min_x = LW_MAX(tile_x, 0);
+    min_y = LW_MAX(tile_y, 0);
+    
+    max_x = LW_MIN(tile_x + width, map->width.t);
+    max_y = LW_MIN(tile_y + height, map->height.t);
+    
+    for (int y = min_y; y < max_y; y++) {
+        for (int x = min_x; x < max_x; x++) {
+            previous_tile_id = GetTile(map, object, x, y);
+            
+            chunk_index = TileXYToChunkIndex(
+                map, map->width.c, 
+                x, y, 
+                &relative_tile_index
+            );
+            
+            if (GetStoredTileId(object, chunk_index, relative_tile_index, previous_tile_id) 
+                == LW_MAX(tile_id, -1))
+                continue;
+            
+            SetTile(map, object, x, y, tile_id);
+            
+            count++;
+        }
+    }
+    
+    return count;
+}
+
+/* 
+    개체 `object`에서 `flag`에 해당하는 변경 사항이 있는 청크의 고유 번호를 최대 `max_count`개까지 
+    `indexes`에 저장하고, 그러한 청크의 개수를 반환한다.
+*/
+int GetDirtyChunkIndexes(LwObject *object, LwDirtyFlag flag, int *indexes, int max_count) {
+    int chunk_index, count = 0;
+    
+    for (int i = 0; i < object->chunkset.dirty_count; i++) {
+        chunk_index = object->chunkset.dirty_indexes[i];
+        
+        if (!(object->chunkset.chunks[chunk_index].dirty & flag))
+            continue;
+        
+        if (indexes != NULL && count < max_count)
+            indexes[count] = chunk_index;
+        
+        count++;
+    }
+    
+    return count;
+}
+
+/* 개체 `object`의 모든 청크에서 `flag`에 해당하는 변경 사항 표시를 지운다. */
+void ClearDirtyChunks(LwObject *object, LwDirtyFlag flag) {
+    LwChunk *chunk;
+    
+    int dirty_count = 0;
+    
+    for (int i = 0; i < object->chunkset.dirty_count; i++) {
+        chunk = &object->chunkset.chunks[object->chunkset.dirty_indexes[i]];
+        
+        chunk->dirty &= ~flag;
+        
+        if (chunk->dirty)
+            object->chunkset.dirty_indexes[dirty_count++] = object->chunkset.dirty_indexes[i];
+    }
+    
+    object->chunkset.dirty_count = dirty_count;
+}
+
+/* 
+    정적 레이어에 속한 개체의 타일이 변경되었을 경우, 변경된 청크만 다시 합성한다. 변경된 청크가 
+    포함된 축소 이미지는 `UpdateMapLod()`를 호출할 때 다시 만들어진다.
+    렌더 텍스처에 그림을 그려야 하므로, `BeginMode2D()`와 `EndMode2D()` 사이에서는 호출하면 안 된다.
+*/
+void UpdateStaticLayers(LwMap *map) {
+    LwObject *object;
+    
+    int last_layer, chunk_index;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid || map->layers[i]._baked == NULL)
+            continue;
+        
+        last_layer = GetStaticLayerRunEnd(map, i);
+        
+        for (int j = i; j <= last_layer; j++) {
+            if (!map->layers[j]._valid)
+                continue;
+            
+            for (int k = map->layers[j]._first_object; 
+                 k >= 0; 
+                 k = map->layers[j].objects[k]._next) {
+                object = &map->layers[j].objects[k];
+                
+                if (!object->_valid || !object->tileset || object->auto_split)
+                    continue;
+                
+                for (int l = 0; l < object->chunkset.dirty_count; l++) {
+                    chunk_index = object->chunkset.dirty_indexes[l];
+                    
+                    if (object->chunkset.chunks[chunk_index].dirty & LW_DIRTY_RENDER)
+                        BakeStaticChunk(map, i, last_layer, chunk_index);
+                }
+                
+                ClearDirtyChunks(object, LW_DIRTY_RENDER);
+            }
+        }
+    }
+    
+    /* 축소 이미지는 화면에 보일 때 다시 만들어지므로, 지금은 다시 만들 이미지만 표시해둔다. */
+    for (int i = 0; i < MAX_LAYER_COUNT; i++)
+        if (map->layers[i]._valid && !map->layers[i]._merged)
+            InvalidateLayerLod(map, i);
+}
+
+/* 
+    개체 `object`에서 고유 번호가 `tile_id`인 타일에 애니메이션이 있다면 현재 프레임의 타일 고유 번호를, 
+    애니메이션이 없다면 `tile_id`를 그대로 반환한다.
+*/
+int GetAnimatedTileId(LwObject *object, int tile_id) {
+    LwTileAnimation *animation;
+    
+    if (!IsAnimatedTileId(object, tile_id))
+        return tile_id;
+    
+    animation = &object->animations[object->animation_lookup[tile_id]];
+    
+    return animation->frames[animation->current_frame];
+}
+
+/* 
+    게임 맵의 모든 타일 애니메이션을 `delta_time`초만큼 진행시킨다. 미리 합성된 정적 레이어에서는 
+    애니메이션 프레임이 바뀐 타일만 다시 그리므로, 애니메이션이 있는 타일의 개수에만 비례하는 
+    시간이 걸린다. 렌더 텍스처에 그림을 그려야 하므로, `BeginMode2D()`와 `EndMode2D()` 사이에서는 
+    호출하면 안 된다.
+*/
+void UpdateTileAnimations(LwMap *map, float delta_time) {
+    LwTileAnimation *animation;
+    LwObject *object;
+    
+    bool changed;
+    
+    double elapsed;
+    
+    int last_layer, chunk_index, animated_count, frame;
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid)
+            continue;
+        
+        for (int j = map->layers[i]._first_object; j >= 0; j = map->layers[i].objects[j]._next) {
+            object = &map->layers[i].objects[j];
+            
+            for (int k = 0; k < object->animation_count; k++) {
+                animation = &object->animations[k];
+                
+                animation->elapsed = fmod(
+                    animation->elapsed + (delta_time * 1000.0), 
+                    animation->total_duration
+                );
+                
+                if (animation->elapsed < 0.0)
+                    animation->elapsed += animation->total_duration;
+                
+                elapsed = animation->elapsed;
+                
+                for (frame = 0; 
+                     frame < animation->frame_count - 1 && elapsed >= animation->durations[frame]; 
+                     frame++)
+                    elapsed -= animation->durations[frame];
+                
+                animation->changed = (frame != animation->current_frame);
+                animation->current_frame = frame;
+            }
+        }
+    }
+    
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        if (!map->layers[i]._valid || map->layers[i]._baked == NULL)
+            continue;
+        
+        last_layer = GetStaticLayerRunEnd(map, i);
+        
+        for (int j = i; j <= last_layer; j++) {
+            if (!map->layers[j]._valid)
+                continue;
+            
+            for (int k = map->layers[j]._first_object; 
+                 k >= 0; 
+                 k = map->layers[j].objects[k]._next) {
+                object = &map->layers[j].objects[k];
+                
+                if (!object->_valid || !object->tileset || object->auto_split 
+                    || object->chunkset.chunks == NULL)
+                    continue;
+                
+                changed = false;
+                
+                for (int l = 0; l < object->animation_count && !changed; l++)
+                    changed = object->animations[l].changed;
+                
+                if (!changed)
+                    continue;
+                
+                /* 애니메이션이 있는 타일이 더 이상 없는 청크는 목록에서 제거한다. */
+                animated_count = 0;
+                
+                for (int l = 0; l < object->chunkset.animated_count; l++) {
+                    chunk_index = object->chunkset.animated_indexes[l];
+                    
+                    if (object->chunkset.chunks[chunk_index].animated_tile_count <= 0) {
+                        object->chunkset.chunks[chunk_index]._animated_listed = false;
+                        
+                        continue;
+                    }
+                    
+                    object->chunkset.animated_indexes[animated_count++] = chunk_index;
+                    
+                    PatchBakedAnimatedTiles(map, i, last_layer, object, chunk_index);
+                }
+                
+                object->chunkset.animated_count = animated_count;
+            }
+        }
+    }
+}
+
+/* ::: 충돌 관련 함수 ::: */
+
+/* 
+    게임 맵에서 타일 기준 좌표가 `(tile_x, tile_y)`인 타일에 충돌 판정이 있는지 확인한다. 
+    타일셋 개체의 `solid_tiles`에 포함된 고유 번호의 타일만 충돌 판정이 있다.
+*/
+bool IsTileSolid(LwMap *map, int tile_x, int tile_y) {
+    if (map->_solid == NULL 
+        || tile_x < 0 || tile_x > map->width.t - 1
+        || tile_y < 0 || tile_y > map->height.t - 1)
+        return false;
+    
+    return (map->_solid[(tile_y * GetSolidRowWords(map)) + (tile_x >> 5)] & (1u << (tile_x & 31))) != 0;
+}
+
+/* 게임 맵에서 위치 `position`이 속한 타일에 충돌 판정이 있는지 확인한다. */
+bool IsTileSolidAt(LwMap *map, Vector2 position) {
+    LwTileCoord coord = PositionToTileCoordMap(map, position);
+    
+    return IsTileSolid(map, coord.x, coord.y);
+}
+
+/* 게임 맵에서 사각형 `rect`와 겹치는 타일 중에 충돌 판정이 있는 타일이 있는지 확인한다. */
+bool QuerySolidInRect(LwMap *map, Rectangle rect) {
+    int min_x, min_y, max_x, max_y;
+    
+    if (map->_solid == NULL)
+        return false;
+    
+    min_x = (int) floorf(rect.x / map->tile_width);
+    min_y = (int) floorf(rect.y / map->tile_height);
+    
+    max_x = (int) ceilf((rect.x + rect.width) / map->tile_width) - 1;
+    max_y = (int) ceilf((rect.y + rect.height) / map->tile_height) - 1;
+    
+    for (int y = LW_MAX(min_y, 0); y <= LW_MIN(max_y, map->height.t - 1); y++)
+        if (FindSolidTileInRow(map, y, min_x, max_x) >= 0)
+            return true;
+    
+    return false;
+}
+
+/* 
+    게임 맵에서 사각형 `rect`를 `delta`만큼 이동시켰을 때, 충돌 판정이 있는 타일과 처음으로 
+    부딪히는 위치를 구한다.
+    
+    사각형의 앞쪽 가장자리가 타일의 경계를 지나는 순서대로 (DDA) 새로 겹치게 되는 한 줄의 타일만 
+    확인하므로, 이동 거리에 비례하는 개수의 줄만 확인한다.
+*/
+LwSweepResult SweepSolidRect(LwMap *map, Rectangle rect, Vector2 delta) {
+    LwSweepResult result = {
+        .time = 1.0f,
+        .position = { rect.x + delta.x, rect.y + delta.y }
+    };
+    
+    float time = 1.0f, time_x, time_y;
+    float next_x, next_y;
+    
+    int step_x, step_y, column, row;
+    int min_tile, max_tile, tile;
+    
+    if (map->_solid == NULL)
+        return result;
+    
+    if (QuerySolidInRect(map, rect)) {
+        result.hit = true;
+        result.time = 0.0f;
+        result.position = (Vector2) { rect.x, rect.y };
+        result.tile = PositionToTileCoordMap(map, result.position);
+        
+        return result;
+    }
+    
+    step_x = (delta.x > 0.0f) - (delta.x < 0.0f);
+    step_y = (delta.y > 0.0f) - (delta.y < 0.0f);
+    
+    column = (step_x > 0) 
+        ? (int) ceilf((rect.x + rect.width) / map->tile_width)
+        : (int) floorf(rect.x / map->tile_width) - 1;
+    row = (step_y > 0) 
+        ? (int) ceilf((rect.y + rect.height) / map->tile_height)
+        : (int) floorf(rect.y / map->tile_height) - 1;
+    
+    for (;;) {
+        /* 게임 맵을 벗어나는 방향으로는 더 이상 부딪힐 타일이 없다. */
+        if (step_x == 0 || (step_x > 0 && column > map->width.t - 1) || (step_x < 0 && column < 0)) {
+            time_x = INFINITY;
+        } else {
+            next_x = (step_x > 0) ? (column * map->tile_width) : ((column + 1) * map->tile_width);
+            time_x = (step_x > 0) 
+                ? (next_x - (rect.x + rect.width)) / delta.x
+                : (next_x - rect.x) / delta.x;
+        }
+        
+        if (step_y == 0 || (step_y > 0 && row > map->height.t - 1) || (step_y < 0 && row < 0)) {
+            time_y = INFINITY;
+        } else {
+            next_y = (step_y > 0) ? (row * map->tile_height) : ((row + 1) * map->tile_height);
+            time_y = (step_y > 0) 
+                ? (next_y - (rect.y + rect.height)) / delta.y
+                : (next_y - rect.y) / delta.y;
+        }
+        
+        if ((time = fminf(time_x, time_y)) >= 1.0f)
+            break;
+        
+        time = fmaxf(time, 0.0f);
+        
+        if (time_x <= time_y) {
+            /* 새로 겹치게 되는 세로 한 줄의 타일을 확인한다. */
+            GetSweepTileRange(
+                rect.y + (delta.y * time), rect.height, map->tile_height, step_y, 
+                &min_tile, &max_tile
+            );
+            
+            for (tile = LW_MAX(min_tile, 0); tile <= LW_MIN(max_tile, map->height.t - 1); tile++)
+                if (IsTileSolid(map, column, tile))
+                    break;
+            
+            if (tile <= LW_MIN(max_tile, map->height.t - 1)) {
+                result.normal = (Vector2) { -step_x, 0.0f };
+                result.tile = (LwTileCoord) { column, tile };
+                
+                break;
+            }
+            
+            column += step_x;
+        } else {
+            /* 새로 겹치게 되는 가로 한 줄의 타일을 워드 단위로 확인한다. */
+            GetSweepTileRange(
+                rect.x + (delta.x * time), rect.width, map->tile_width, step_x, 
+                &min_tile, &max_tile
+            );
+            
+            if ((tile = FindSolidTileInRow(map, row, min_tile, max_tile)) >= 0) {
+                result.normal = (Vector2) { 0.0f, -step_y };
+                result.tile = (LwTileCoord) { tile, row };
+                
+                break;
+            }
+            
+            row += step_y;
+        }
+    }
+    
+    if (result.normal.x != 0.0f || result.normal.y != 0.0f) {
+        result.hit = true;
+        result.time = time;
+        result.position = (Vector2) { rect.x + (delta.x * time), rect.y + (delta.y * time) };
+    }
+    
+    return result;
+}
+
+/* 
+    타일셋 개체 `object`에서 위치 `origin`으로부터 방향 `direction`으로 최대 `max_distance`만큼 
+    광선을 쏘아, 광선을 가로막는 첫 번째 타일을 구한다. 개체에 `solid_tiles`가 있다면 충돌 판정이 
+    있는 타일만, 없다면 비어 있지 않은 모든 타일이 광선을 가로막는다.
+*/
+LwRaycastResult RaycastTiles(
+    LwMap *map, LwObject *object, 
+    Vector2 origin, Vector2 direction, float max_distance
+) {
+    LwRaycastResult result;
+    
+    int *buffer = NULL;
+    
+    if (!object->loaded)
+        LoadObject(map, object);
+    
+    if (!object->tileset || object->auto_split)
+        return (LwRaycastResult) { .tile_id = -1 };
+    
+    result = CastTileRay(map, object, origin, direction, max_distance, &buffer);
+    
+    RL_FREE(buffer);
+    
+    return result;
+}
+
+/* 타일셋 개체 `object`에서 위치 `from`과 `to` 사이를 가로막는 타일이 없는지 확인한다. */
+bool HasLineOfSight(LwMap *map, LwObject *object, Vector2 from, Vector2 to) {
+    Vector2 direction = { to.x - from.x, to.y - from.y };
+    
+    float distance = sqrtf((direction.x * direction.x) + (direction.y * direction.y));
+    
+    if (distance == 0.0f)
+        return !IsRayBlockingTile(
+            object, 
+            GetTile(map, object, (int) floorf(from.x / map->tile_width), (int) floorf(from.y / map->tile_height))
+        );
+    
+    return !RaycastTiles(map, object, from, direction, distance).hit;
+}
+
+/* 
+    타일셋 개체 `object`에서 `count`개의 광선 `queries`를 한 번에 쏘아 결과를 `results`에 저장하고, 
+    타일에 부딪힌 광선의 개수를 반환한다. 광선이 충분히 많다면 여러 스레드로 나누어 처리한다.
+*/
+int RaycastTilesBatch(
+    LwMap *map, LwObject *object, 
+    const LwRaycastQuery *queries, LwRaycastResult *results, 
+    int count
+) {
+    LwRaycastTask tasks[LW_RAYCAST_THREAD_COUNT];
+    
+    int task_count, hits = 0;
+    
+    if (count <= 0)
+        return 0;
+    
+    /* 스레드에서는 게임 맵과 개체의 데이터를 읽기만 하도록, 개체를 미리 불러온다. */
+    if (!object->loaded)
+        LoadObject(map, object);
+    
+    if (!object->tileset || object->auto_split) {
+        for (int i = 0; i < count; i++)
+            results[i] = (LwRaycastResult) { .tile_id = -1 };
+        
+        return 0;
+    }
+    
+    task_count = (count >= LW_RAYCAST_BATCH_MIN) ? LW_RAYCAST_THREAD_COUNT : 1;
+    
+    for (int i = 0; i < task_count; i++)
+        tasks[i] = (LwRaycastTask) {
+            .map = map,
+            .object = object,
+            .queries = queries,
+            .results = results,
+            .begin = (int) (((long long) count * i) / task_count),
+            .end = (int) (((long long) count * (i + 1)) / task_count)
+        };
+    
+#ifndef LOWEL_NO_THREADS
+    {
+        pthread_t threads[LW_RAYCAST_THREAD_COUNT];
+        
+        bool started[LW_RAYCAST_THREAD_COUNT] = { false };
+        
+        /* 첫 번째 작업은 호출한 스레드에서 직접 처리한다. */
+        for (int i = 1; i < task_count; i++)
+            started[i] = (pthread_create(&threads[i], NULL, RunRaycastTask, &tasks[i]) == 0);
+        
+        RunRaycastTask(&tasks[0]);
+        
+        for (int i = 1; i < task_count; i++) {
+            if (started[i])
+                pthread_join(threads[i], NULL);
+            else
+                RunRaycastTask(&tasks[i]);
+        }
+    }
+#else
+    for (int i = 0; i < task_count; i++)
+        RunRaycastTask(&tasks[i]);
+#endif
+    
+    for (int i = 0; i < task_count; i++)
+        hits += tasks[i].hits;
+    
+    return hits;
+}
+
+/* ::: 경로 탐색 관련 함수 ::: */
+
+/* 
+    게임 맵 `map`에서 경로를 탐색할 때 사용할 메모리를 미리 할당한다. 같은 컨텍스트로 경로를 여러 번 
+    탐색해도 메모리를 다시 할당하지 않는다. 게임 맵의 크기가 바뀌면 다시 만들어야 한다.
+*/
+LwPathContext *LoadPathContext(LwMap *map) {
+    LwPathContext *context = (LwPathContext *) RL_CALLOC(1, sizeof(LwPathContext));
+    
+    context->map = map;
+    
+    context->tile_count = map->width.t * map->height.t;
+    context->node_count = (map->width.c * map->height.c * LW_PATH_MAX_CHUNK_NODES) + 2;
+    
+    context->tile_stamps = (unsigned int *) RL_CALLOC(context->tile_count, sizeof(unsigned int));
+    context->tile_costs = (int *) RL_CALLOC(context->tile_count, sizeof(int));
+    context->tile_parents = (int *) RL_CALLOC(context->tile_count, sizeof(int));
+    context->queue = (int *) RL_CALLOC(context->tile_count, sizeof(int));
+    context->flow_costs = (int *) RL_CALLOC(context->tile_count, sizeof(int));
+    
+    for (int i = 0; i < context->tile_count; i++)
+        context->flow_costs[i] = -1;
+    
+    context->node_stamps = (unsigned int *) RL_CALLOC(context->node_count, sizeof(unsigned int));
+    context->node_costs = (int *) RL_CALLOC(context->node_count, sizeof(int));
+    context->node_scores = (int *) RL_CALLOC(context->node_count, sizeof(int));
+    context->node_parents = (int *) RL_CALLOC(context->node_count, sizeof(int));
+    context->node_order = (int *) RL_CALLOC(context->node_count, sizeof(int));
+    context->heap = (int *) RL_CALLOC(context->node_count, sizeof(int));
+    context->heap_positions = (int *) RL_CALLOC(context->node_count, sizeof(int));
+    
+    return context;
+}
+
+/* 경로 탐색 컨텍스트의 메모리를 해제한다. */
+void UnloadPathContext(LwPathContext *context) {
+    if (context == NULL)
+        return;
+    
+    RL_FREE(context->tile_stamps);
+    RL_FREE(context->tile_costs);
+    RL_FREE(context->tile_parents);
+    RL_FREE(context->queue);
+    RL_FREE(context->flow_costs);
+    RL_FREE(context->node_stamps);
+    RL_FREE(context->node_costs);
+    RL_FREE(context->node_scores);
+    RL_FREE(context->node_parents);
+    RL_FREE(context->node_order);
+    RL_FREE(context->heap);
+    RL_FREE(context->heap_positions);
+    RL_FREE(context);
+}
+
+/* 
+    타일 `start`에서 타일 `goal`까지 충돌 판정이 없는 타일만 상하좌우로 지나가는 경로를 찾아, 
+    `start`와 `goal`을 포함한 경로를 최대 `max_length`개까지 `path`에 저장한다. 
+    경로 전체의 길이를 반환하며, 경로가 없다면 `-1`을 반환한다.
+    
+    먼저 청크의 경계에 있는 출입구만으로 이루어진 그래프에서 A* 알고리즘으로 경로를 찾은 다음 (HPA*), 
+    경로가 지나가는 청크 안에서만 타일 단위의 경로를 구한다.
+*/
+int FindPath(
+    LwPathContext *context, 
+    LwTileCoord start, LwTileCoord goal, 
+    LwTileCoord *path, int max_length
+) {
+    LwMap *map = context->map;
+    LwPathGraph *graph;
+    
+    int start_node = context->node_count - 2, goal_node = context->node_count - 1;
+    int start_index, goal_index, start_chunk, goal_chunk;
+    int min_x, min_y, max_x, max_y;
+    int node, next, chunk_index, slot, count, cost, length;
+    int order_count = 0;
+    
+    if (!IsTileWalkable(map, start.x, start.y) || !IsTileWalkable(map, goal.x, goal.y))
+        return -1;
+    
+    UpdatePathGraph(context);
+    
+    graph = map->_path_graph;
+    
+    start_index = (start.y * map->width.t) + start.x;
+    goal_index = (goal.y * map->width.t) + goal.x;
+    
+    start_chunk = TileIndexToChunkIndexMap(map, start_index);
+    goal_chunk = TileIndexToChunkIndexMap(map, goal_index);
+    
+    if (max_length > 0)
+        path[0] = start;
+    
+    /* 출발점과 도착점이 같은 청크에 있다면, 청크 안에서 먼저 찾아본다. */
+    if (start_chunk == goal_chunk) {
+        GetChunkTileBounds(map, start_chunk, &min_x, &min_y, &max_x, &max_y);
+        
+        if (SearchPathTiles(context, start_index, goal_index, min_x, min_y, max_x, max_y) >= 0)
+            return WritePathTiles(context, goal_index, path, 1, max_length) + 1;
+    }
+    
+    /* 출발점과 도착점을 각자 속한 청크의 출입구와 연결한다. */
+    GetChunkTileBounds(map, goal_chunk, &min_x, &min_y, &max_x, &max_y);
+    
+    SearchPathTiles(context, goal_index, -1, min_x, min_y, max_x, max_y);
+    
+    for (int i = 0; i < graph->node_counts[goal_chunk]; i++) {
+        int tile = graph->node_tiles[(goal_chunk * LW_PATH_MAX_CHUNK_NODES) + i];
+        
+        context->goal_costs[i] = (context->tile_stamps[tile] == context->generation) 
+            ? context->tile_costs[tile] 
+            : -1;
+    }
+    
+    GetChunkTileBounds(map, start_chunk, &min_x, &min_y, &max_x, &max_y);
+    
+    SearchPathTiles(context, start_index, -1, min_x, min_y, max_x, max_y);
+    
+    for (int i = 0; i < graph->node_counts[start_chunk]; i++) {
+        int tile = graph->node_tiles[(start_chunk * LW_PATH_MAX_CHUNK_NODES) + i];
+        
+        context->start_costs[i] = (context->tile_stamps[tile] == context->generation) 
+            ? context->tile_costs[tile] 
+            : -1;
+    }
+    
+    context->generation++;
+    context->heap_size = 0;
+    
+    RelaxPathNode(context, start_node, -1, 0, 0);
+    
+    while (context->heap_size > 0) {
+        if ((node = PopPathHeap(context)) == goal_node)
+            break;
+        
+        if (node == start_node) {
+            chunk_index = start_chunk;
+            count = graph->node_counts[start_chunk];
+        } else {
+            chunk_index = node / LW_PATH_MAX_CHUNK_NODES;
+            count = graph->node_counts[chunk_index];
+        }
+        
+        for (int i = 0; i < count; i++) {
+            next = (chunk_index * LW_PATH_MAX_CHUNK_NODES) + i;
+            
+            if (node == start_node) {
+                if ((cost = context->start_costs[i]) < 0)
+                    continue;
+            } else {
+                slot = node % LW_PATH_MAX_CHUNK_NODES;
+                
+                if (i == slot || graph->distances[(((chunk_index * LW_PATH_MAX_CHUNK_NODES) + slot) 
+                    * LW_PATH_MAX_CHUNK_NODES) + i] == LW_PATH_NO_EDGE)
+                    continue;
+                
+                cost = graph->distances[(((chunk_index * LW_PATH_MAX_CHUNK_NODES) + slot) 
+                    * LW_PATH_MAX_CHUNK_NODES) + i];
+            }
+            
+            RelaxPathNode(
+                context, next, node, 
+                context->node_costs[node] + cost, 
+                abs(GetMapTileX(map, graph->node_tiles[next]) - goal.x) 
+                    + abs(GetMapTileY(map, graph->node_tiles[next]) - goal.y)
+            );
+        }
+        
+        if (node == start_node)
+            continue;
+        
+        /* 이웃한 청크의 출입구로 건너가거나, 도착점이 속한 청크라면 도착점으로 이동한다. */
+        if ((next = GetPathNodePartner(context, node)) >= 0)
+            RelaxPathNode(
+                context, next, node, 
+                context->node_costs[node] + 1, 
+                abs(GetMapTileX(map, graph->node_tiles[next]) - goal.x) 
+                    + abs(GetMapTileY(map, graph->node_tiles[next]) - goal.y)
+            );
+        
+        if (chunk_index == goal_chunk && context->goal_costs[node % LW_PATH_MAX_CHUNK_NODES] >= 0)
+            RelaxPathNode(
+                context, goal_node, node, 
+                context->node_costs[node] + context->goal_costs[node % LW_PATH_MAX_CHUNK_NODES], 
+                0
+            );
+    }
+    
+    if (context->node_stamps[goal_node] != context->generation 
+        || context->heap_positions[goal_node] != -2)
+        return -1;
+    
+    for (node = goal_node; node >= 0; node = context->node_parents[node])
+        context->node_order[order_count++] = node;
+    
+    /* 찾은 출입구 사이의 경로를, 청크 안에서 타일 단위로 다시 구한다. */
+    length = 1;
+    
+    for (int i = order_count - 1; i > 0; i--) {
+        int from = context->node_order[i], to = context->node_order[i - 1];
+        
+        int from_index = (from == start_node) ? start_index : graph->node_tiles[from];
+        int to_index = (to == goal_node) ? goal_index : graph->node_tiles[to];
+        
+        if (from_index == to_index)
+            continue;
+        
+        chunk_index = (from == start_node) ? start_chunk : from / LW_PATH_MAX_CHUNK_NODES;
+        
+        if (to != goal_node && from != start_node && to / LW_PATH_MAX_CHUNK_NODES != chunk_index) {
+            if (length < max_length)
+                path[length] = (LwTileCoord) { GetMapTileX(map, to_index), GetMapTileY(map, to_index) };
+            
+            length++;
+            
+            continue;
+        }
+        
+        GetChunkTileBounds(map, chunk_index, &min_x, &min_y, &max_x, &max_y);
+        
+        SearchPathTiles(context, from_index, to_index, min_x, min_y, max_x, max_y);
+        
+        length += WritePathTiles(context, to_index, path, length, max_length);
+    }
+    
+    return length;
+}
+
+/* 
+    모든 타일에서 타일 `goal`까지의 거리를 계산하여, 여러 개체가 같은 목적지로 이동할 때 사용할 
+    흐름 필드를 만든다. 흐름 필드는 다시 만들기 전까지 컨텍스트에 저장된다.
+*/
+bool BuildFlowField(LwPathContext *context, LwTileCoord goal) {
+    LwMap *map = context->map;
+    
+    for (int i = 0; i < context->tile_count; i++)
+        context->flow_costs[i] = -1;
+    
+    if (!IsTileWalkable(map, goal.x, goal.y))
+        return false;
+    
+    SearchPathTiles(
+        context, 
+        (goal.y * map->width.t) + goal.x, -1, 
+        0, 0, map->width.t - 1, map->height.t - 1
+    );
+    
+    for (int i = 0; i < context->tile_count; i++)
+        if (context->tile_stamps[i] == context->generation)
+            context->flow_costs[i] = context->tile_costs[i];
+    
+    return true;
+}
+
+/* 흐름 필드에서 타일 `tile`에서 목적지로 가기 위해 다음으로 이동할 타일을 반환한다. */
+LwTileCoord GetFlowFieldNext(LwPathContext *context, LwTileCoord tile) {
+    static const int offsets[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+    
+    LwTileCoord result = tile;
+    
+    int best_cost, cost;
+    
+    if ((best_cost = GetFlowFieldCost(context, tile)) <= 0)
+        return result;
+    
+    for (int i = 0; i < 4; i++) {
+        LwTileCoord next = { tile.x + offsets[i][0], tile.y + offsets[i][1] };
+        
+        if ((cost = GetFlowFieldCost(context, next)) >= 0 && cost < best_cost) {
+            best_cost = cost;
+            result = next;
+        }
+    }
+    
+    return result;
+}
+
+/* 흐름 필드에서 타일 `tile`부터 목적지까지의 거리를 반환한다. 갈 수 없는 타일이라면 `-1`을 반환한다. */
+int GetFlowFieldCost(LwPathContext *context, LwTileCoord tile) {
+    LwMap *map = context->map;
+    
+    if (tile.x < 0 || tile.x > map->width.t - 1 || tile.y < 0 || tile.y > map->height.t - 1)
+        return -1;
+    
+    return context->flow_costs[(tile.y * map->width.t) + tile.x];
+}
+
+/* ::: 전장의 안개 관련 함수 ::: */
+
+/* 
+    타일 기준 좌표가 `center`인 타일에서 반지름이 `radius`인 원 안의 타일을 지금 보이는 타일과 
+    본 적이 있는 타일로 표시한다. 충돌 판정이 있는 타일에 가려지는지는 확인하지 않는다.
+*/
+void RevealFogRadius(LwMap *map, LwTileCoord center, int radius) {
+    int half_width;
+    
+    if (radius < 0 || !InitFog(map))
+        return;
+    
+    for (int delta_y = -radius; delta_y <= radius; delta_y++) {
+        half_width = (int) sqrtf((float) ((radius * radius) - (delta_y * delta_y)));
+        
+        RevealFogSpan(map, center.y + delta_y, center.x - half_width, center.x + half_width);
+    }
+}
+
+/* 
+    타일 기준 좌표가 `center`인 타일에서 반지름이 `radius`인 원 안의 타일 중, 충돌 판정이 있는 
+    타일에 가려지지 않은 타일만 지금 보이는 타일과 본 적이 있는 타일로 표시한다.
+*/
+void RevealFogShadowcast(LwMap *map, LwTileCoord center, int radius) {
+    static const int multipliers[4][8] = {
+        { 1, 0, 0, -1, -1, 0, 0, 1 },
+        { 0, 1, -1, 0, 0, -1, 1, 0 },
+        { 0, 1, 1, 0, 0, -1, -1, 0 },
+        { 1, 0, 0, 1, -1, 0, 0, -1 }
+    };
+    
+    if (radius < 0 || !InitFog(map))
+        return;
+    
+    RevealFogSpan(map, center.y, center.x, center.x);
+    
+    for (int i = 0; i < 8; i++)
+        CastFogShadow(
+            map, center, radius, 1, 1.0f, 0.0f, 
+            multipliers[0][i], multipliers[1][i], 
+            multipliers[2][i], multipliers[3][i]
+        );
+}
+
+/* 지금 보이는 타일의 표시를 모두 지운다. 본 적이 있는 타일의 표시는 그대로 남는다. */
+void ClearFogVisible(LwMap *map) {
+    LwFog *fog = map->_fog;
+    
+    if (fog == NULL)
+        return;
+    
+    /* 지금 보이는 타일이 있는 청크의 목록만 따라가므로, 게임 맵 전체를 지우지 않아도 된다. */
+    for (int i = 0; i < fog->visible_count; i++) {
+        memset(
+            &fog->visible[fog->visible_indexes[i] * fog->chunk_words], 
+            0, 
+            fog->chunk_words * sizeof(uint32_t)
+        );
+        
+        fog->visible_listed[fog->visible_indexes[i]] = false;
+    }
+    
+    fog->visible_count = 0;
+}
+
+/* 타일 기준 좌표가 `(x, y)`인 타일을 본 적이 있는지 확인한다. */
+bool IsTileExplored(LwMap *map, int x, int y) {
+    if (x < 0 || x > map->width.t - 1 || y < 0 || y > map->height.t - 1)
+        return false;
+    
+    return (map->_fog == NULL) || IsFogTileSet(map, map->_fog->explored, x, y);
+}
+
+/* 타일 기준 좌표가 `(x, y)`인 타일이 지금 보이는지 확인한다. */
+bool IsTileVisible(LwMap *map, int x, int y) {
+    if (x < 0 || x > map->width.t - 1 || y < 0 || y > map->height.t - 1)
+        return false;
+    
+    return (map->_fog == NULL) || IsFogTileSet(map, map->_fog->visible, x, y);
+}
+
+/* 본 적이 있는 타일의 표시를 파일에 저장한다. */
+bool SaveFog(LwMap *map, const char *file_path) {
+    char *fog_data;
+    
+    bool result;
+    
+    if (!SaveFogToMemory(map, &fog_data))
+        return false;
+    
+    result = SaveFileText(file_path, fog_data);
+    
+    RL_FREE(fog_data);
+    
+    return result;
+}
+
+/* 
+    본 적이 있는 타일의 표시를 메모리에 저장한다. 게임 맵의 크기 다음에, 타일을 가로 방향으로 
+    차례대로 훑으며 본 적이 없는 타일과 본 적이 있는 타일이 이어지는 길이를 번갈아 저장한다.
+*/
+bool SaveFogToMemory(LwMap *map, char **fog_data) {
+    unsigned char *packed;
+    
+    int tile_count = map->width.t * map->height.t, packed_size = 0, run = 0;
+    
+    bool explored, current = false;
+    
+    if (tile_count <= 0)
+        return false;
+    
+    packed = (unsigned char *) RL_MALLOC((tile_count + 3) * 5);
+    
+    packed_size += WriteVarint(packed + packed_size, (unsigned int) map->width.t);
+    packed_size += WriteVarint(packed + packed_size, (unsigned int) map->height.t);
+    
+    for (int y = 0; y < map->height.t; y++) {
+        for (int x = 0; x < map->width.t; x++) {
+            explored = (map->_fog == NULL) || IsFogTileSet(map, map->_fog->explored, x, y);
+            
+            if (explored != current) {
+                packed_size += WriteVarint(packed + packed_size, (unsigned int) run);
+                
+                current = explored;
+                run = 0;
+            }
+            
+            run++;
+        }
+    }
+    
+    packed_size += WriteVarint(packed + packed_size, (unsigned int) run);
+    
+    *fog_data = EncodeBase64(packed, packed_size);
+    
+    RL_FREE(packed);
+    
+    return true;
+}
+
+/* 파일에서 본 적이 있는 타일의 표시를 불러온다. */
+bool LoadFog(LwMap *map, const char *file_path) {
+    char *fog_data;
+    
+    bool result;
+    
+    if ((fog_data = LoadFileText(file_path)) == NULL)
+        return false;
+    
+    result = LoadFogFromMemory(map, fog_data);
+    
+    RL_FREE(fog_data);
+    
+    return result;
+}
+
+/* 메모리에서 본 적이 있는 타일의 표시를 불러온다. 지금 보이는 타일의 표시는 모두 지워진다. */
+bool LoadFogFromMemory(LwMap *map, const char *fog_data) {
+    unsigned char *packed;
+    
+    unsigned int width, height, run;
+    
+    int packed_size, offset = 0, length, position = 0, tile_count, span;
+    
+    bool explored = false, result;
+    
+    packed = (unsigned char *) RL_MALLOC(((strlen(fog_data) * 3) / 4) + 1);
+    
+    packed_size = DecodeBase64(fog_data, packed);
+    
+    if (packed_size > 0 && (length = ReadVarint(packed, packed_size, &width)) > 0)
+        offset += length;
+    
+    if (offset == 0 || (length = ReadVarint(packed + offset, packed_size - offset, &height)) == 0) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to load fog data: invalid data", 
+            map->name
+        );
+        
+        RL_FREE(packed);
+        
+        return false;
+    }
+    
+    offset += length;
+    
+    if (width != (unsigned int) map->width.t || height != (unsigned int) map->height.t) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to load fog data: "
+            "the size of fog data (%ux%u) does not match the size of the map",
+            map->name, width, height
+        );
+        
+        RL_FREE(packed);
+        
+        return false;
+    }
+    
+    UnloadFog(map);
+    
+    if (!InitFog(map)) {
+        RL_FREE(packed);
+        
+        return false;
+    }
+    
+    tile_count = map->width.t * map->height.t;
+    
+    while (offset < packed_size) {
+        if ((length = ReadVarint(packed + offset, packed_size - offset, &run)) == 0
+            || run > (unsigned int) (tile_count - position))
+            break;
+        
+        offset += length;
+        
+        /* 본 적이 있는 타일이 이어지는 구간을 가로 방향의 행 단위로 나누어 표시한다. */
+        for (int remaining = (int) run; explored && remaining > 0; remaining -= span) {
+            span = LW_MIN(remaining, map->width.t - (position % map->width.t));
+            
+            RevealFogSpan(
+                map, 
+                position / map->width.t, 
+                position % map->width.t, 
+                (position % map->width.t) + span - 1
+            );
+            
+            position += span;
+        }
+        
+        if (!explored)
+            position += (int) run;
+        
+        explored = !explored;
+    }
+    
+    result = (offset == packed_size && position == tile_count);
+    
+    if (!result)
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [MAP '%s'] Failed to load fog data: invalid data", 
+            map->name
+        );
+    
+    ClearFogVisible(map);
+    
+    RL_FREE(packed);
+    
+    return result;
+}
+
+/* 전장의 안개에 할당된 메모리를 해제한다. 전장의 안개가 없으면 모든 타일이 보인다. */
+void UnloadFog(LwMap *map) {
+    if (map->_fog == NULL)
+        return;
+    
+    RL_FREE(map->_fog->explored);
+    RL_FREE(map->_fog->visible);
+    RL_FREE(map->_fog->explored_counts);
+    RL_FREE(map->_fog->visible_indexes);
+    RL_FREE(map->_fog->visible_listed);
+    
+    RL_FREE(map->_fog);
+    
+    map->_fog = NULL;
+}
+
+/* ::: 조명 관련 함수 ::: */
+
+/* 
+    타일 기준 좌표가 `position`인 타일에 밝기가 `level`인 빛을 추가한다. 빛은 상하좌우로 한 칸 
+    퍼질 때마다 밝기가 1씩 줄어들며, 빛이 닿는 타일의 밝기만 다시 계산한다.
+*/
+bool AddLight(LwMap *map, LwTileCoord position, int level) {
+    LwLight *light;
+    
+    if (position.x < 0 || position.x > map->width.t - 1 
+        || position.y < 0 || position.y > map->height.t - 1
+        || level <= 0 || !InitLight(map))
+        return false;
+    
+    light = map->_light;
+    
+    level = LW_MIN(level, MAX_LIGHT_LEVEL);
+    
+    if (light->source_count >= light->source_capacity) {
+        light->source_capacity = (light->source_capacity > 0) ? (light->source_capacity * 2) : 16;
+        light->sources = (LwLightSource *) RL_REALLOC(
+            light->sources, 
+            light->source_capacity * sizeof(LwLightSource)
+        );
+    }
+    
+    light->sources[light->source_count++] = (LwLightSource) { position, level };
+    
+    SeedLightSources(map);
+    PropagateLight(map);
+    
+    FlushLightChunks(map);
+    
+    return true;
+}
+
+/* 
+    타일 기준 좌표가 `position`인 타일에 추가된 빛을 하나 제거한다. 그 빛이 닿았던 타일의 밝기만 
+    다시 계산한다.
+*/
+bool RemoveLight(LwMap *map, LwTileCoord position) {
+    LwLight *light = map->_light;
+    
+    int index = -1;
+    
+    if (light == NULL)
+        return false;
+    
+    for (int i = 0; i < light->source_count && index < 0; i++)
+        if (light->sources[i].position.x == position.x && light->sources[i].position.y == position.y)
+            index = i;
+    
+    if (index < 0)
+        return false;
+    
+    light->sources[index] = light->sources[--light->source_count];
+    
+    if (!IsLightBlocked(map, position.x, position.y))
+        RemoveLightFrom(map, position.x, position.y);
+    
+    FlushLightChunks(map);
+    
+    return true;
+}
+
+/* 
+    빛이 닿지 않는 타일에도 적용할 최소 밝기를 `level`로 설정한다. 조명을 처음 만들었을 때의 
+    최소 밝기는 `0`이다.
+*/
+void SetAmbientLight(LwMap *map, int level) {
+    level = LW_MAX(0, LW_MIN(level, MAX_LIGHT_LEVEL));
+    
+    if (!InitLight(map) || map->_light->ambient == level)
+        return;
+    
+    map->_light->ambient = level;
+    
+    /* 모든 타일의 색상이 바뀌므로, 모든 청크를 다시 그려야 한다. */
+    for (int i = 0; i < map->width.c * map->height.c; i++)
+        MarkLightChunk(map, i);
+    
+    FlushLightChunks(map);
+}
+
+/* 
+    타일 기준 좌표가 `(x, y)`인 타일의 밝기를 반환한다. 최소 밝기는 반영하지 않는다. 
+    조명이 없다면 `MAX_LIGHT_LEVEL`을 반환한다.
+*/
+int GetTileLight(LwMap *map, int x, int y) {
+    if (x < 0 || x > map->width.t - 1 || y < 0 || y > map->height.t - 1)
+        return 0;
+    
+    return (map->_light != NULL) ? *GetLightLevel(map, x, y) : MAX_LIGHT_LEVEL;
+}
+
+/* 조명에 할당된 메모리를 해제한다. 조명이 없으면 모든 타일을 원래의 색상으로 그린다. */
+void UnloadLights(LwMap *map) {
+    if (map->_light == NULL)
+        return;
+    
+    RL_FREE(map->_light->levels);
+    RL_FREE(map->_light->opaque);
+    RL_FREE(map->_light->sources);
+    RL_FREE(map->_light->queue);
+    RL_FREE(map->_light->removals);
+    RL_FREE(map->_light->changed_indexes);
+    RL_FREE(map->_light->changed_listed);
+    
+    RL_FREE(map->_light);
+    
+    map->_light = NULL;
+}
+
+/* ::: 월드 관련 함수 ::: */
+
+/* 
+    파일에서 월드 데이터를 불러온다. 월드에 포함된 게임 맵은 `UpdateWorld()`를 호출할 때 
+    플레이어의 위치에 따라 불러온다.
+*/
+bool LoadWorld(LwWorld *world, const char *file_path) {
+    JsonArena *arena;
+    JsonNode *node_root, *node_current;
+    JsonNode *node_cell, *node_member;
+    
+    LwMap header = { 0 };
+    LwWorldCell *cell;
+    
+    const char *path;
+    char *world_data;
+    
+    int cell_x, cell_y;
+    
+    if ((world_data = LoadFileText(file_path)) == NULL)
+        return false;
+    
+    arena = json_arena_new();
+    
+    node_root = json_decode_arena(world_data, arena);
+    
+    RL_FREE(world_data);
+    
+    if (node_root == NULL) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: Failed to load world data: `json_decode()` error"
+        );
+        
+        json_arena_free(arena);
+        
+        return false;
+    }
+    
+    node_current = json_first_child(node_root);
+    
+    /* 월드 데이터의 `header` 노드는 게임 맵 데이터의 `header` 노드와 형식이 같다. */
+    if (node_current == NULL || !LoadHeaderData(&header, &node_current)
+        || node_current == NULL || node_current->next == NULL) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: Failed to load world data: invalid world format"
+        );
+        
+        RL_FREE(header.name);
+        
+        json_arena_free(arena);
+        
+        return false;
+    }
+    
+    world->name = header.name;
+    world->load_distance = 1;
+    
+    json_foreach(node_member, node_current) {
+        switch (GetKeyType(node_member->key)) {
+            case LW_KEY_WIDTH:
+                world->width = (int) node_member->number_;
+                break;
+                
+            case LW_KEY_HEIGHT:
+                world->height = (int) node_member->number_;
+                break;
+                
+            case LW_KEY_MAP_WIDTH:
+                world->map_width = (int) node_member->number_;
+                break;
+                
+            case LW_KEY_MAP_HEIGHT:
+                world->map_height = (int) node_member->number_;
+                break;
+                
+            case LW_KEY_LOAD_DISTANCE_M:
+                world->load_distance = (int) node_member->number_;
+                break;
+                
+            default:
+                break;
+        }
+    }
+    
+    if (world->width <= 0 || world->height <= 0 
+        || world->map_width <= 0 || world->map_height <= 0
+        || world->load_distance < 0) {
+        TraceLog(
+            LOG_ERROR, 
+            "LOWEL: [WORLD '%s'] Failed to load world data: "
+            "the value of width/height property must not be negative",
+            world->name
+        );
+        
+        RL_FREE(world->name);
+        
+        world->name = NULL;
+        
+        json_arena_free(arena);
+        
+        return false;
+    }
+    
+    world->_cells = (LwWorldCell *) RL_CALLOC(
+        world->width * world->height, 
+        sizeof(LwWorldCell)
+    );
+    
+#ifndef LOWEL_NO_THREADS
+    for (int i = 0; i < (world->width * world->height); i++)
+        pthread_mutex_init(&world->_cells[i].lock, NULL);
+#endif
+    
+    json_foreach(node_cell, node_current->next) {
+        cell_x = cell_y = -1;
+        
+        path = NULL;
+        
+        json_foreach(node_member, node_cell) {
+            switch (GetKeyType(node_member->key)) {
+                case LW_KEY_X:
+                    cell_x = (int) node_member->number_;
+                    break;
+                    
+                case LW_KEY_Y:
+                    cell_y = (int) node_member->number_;
+                    break;
+                    
+                case LW_KEY_PATH:
+                    path = node_member->string_;
+                    break;
+                    
+                default:
+                    break;
+            }
+        }
+        
+        if (cell_x < 0 || cell_x > world->width - 1 
+            || cell_y < 0 || cell_y > world->height - 1
+            || path == NULL || TextLength(path) == 0) {
+            TraceLog(
+                LOG_WARNING, 
+                "LOWEL: [WORLD '%s'] Ignoring an invalid map entry",
+                world->name
+            );
+            
+            continue;
+        }
+        
+        cell = &world->_cells[(cell_y * world->width) + cell_x];
+        
+        if (cell->path == NULL)
+            cell->path = (char *) RL_CALLOC(MAX_STRING_LENGTH, sizeof(char));
+        
+        /* 게임 맵 파일의 경로는 월드 파일이 있는 디렉토리를 기준으로 한다. */
+        if (path[0] == '/' || (path[0] != '\0' && path[1] == ':'))
+            TextCopy(cell->path, path);
+        else
+            TextCopy(cell->path, TextFormat("%s/%s", GetDirectoryPath(file_path), path));
+    }
+    
+    json_arena_free(arena);
+    
+    TraceLog(
+        LOG_INFO, 
+        "LOWEL: [WORLD '%s'] Loaded world data successfully",
+        world->name
+    );
+    
+    return true;
+}
+
+/* 월드 데이터와 월드에 포함된 모든 게임 맵의 메모리를 해제한다. */
+void UnloadWorld(LwWorld *world) {
+    LwWorldCell *cell;
+    
+    if (world->_cells == NULL)
+        return;
+    
+    for (int i = 0; i < (world->width * world->height); i++) {
+        cell = &world->_cells[i];
+        
+#ifndef LOWEL_NO_THREADS
+        if (cell->threaded)
+            pthread_join(cell->thread, NULL);
+        
+        pthread_mutex_destroy(&cell->lock);
+#endif
+        
+        if (cell->state == LW_WORLD_CELL_LOADING || cell->state == LW_WORLD_CELL_READY)
+            UnloadWorldCellData(cell);
+        
+        RL_FREE(cell->path);
+    }
+    
+    RL_FREE(world->_cells);
+    RL_FREE(world->name);
+    
+    world->_cells = NULL;
+    world->name = NULL;
+}
+
+/* 
+    월드 기준 위치 `position`을 기준으로, 가까운 게임 맵은 백그라운드에서 불러오고 먼 게임 맵은 
+    메모리에서 해제한다. 플레이어가 있는 칸의 게임 맵은 바로 사용할 수 있도록 기다렸다가 불러온다.
+    렌더 텍스처에 그림을 그릴 수 있으므로, `BeginMode2D()`와 `EndMode2D()` 사이에서는 호출하면 안 된다.
+*/
+void UpdateWorld(LwWorld *world, Vector2 position) {
+    LwWorldCell *cell;
+    
+    int center_x, center_y, distance;
+    
+    center_x = (int) floor(position.x / world->map_width);
+    center_y = (int) floor(position.y / world->map_height);
+    
+    for (int y = 0; y < world->height; y++) {
+        for (int x = 0; x < world->width; x++) {
+            cell = &world->_cells[(y * world->width) + x];
+            
+            if (cell->path == NULL)
+                continue;
+            
+            distance = LW_MAX(abs(x - center_x), abs(y - center_y));
+            
+            if (distance <= world->load_distance && cell->state == LW_WORLD_CELL_UNLOADED)
+                BeginWorldCellLoad(cell);
+            
+            PollWorldCellLoad(world, cell, distance == 0);
+            
+            /* 경계에서 게임 맵을 반복해서 불러오지 않도록, 한 칸의 여유를 둔다. */
+            if (distance > world->load_distance + 1 && cell->state == LW_WORLD_CELL_READY) {
+                UnloadWorldCellData(cell);
+                
+                cell->state = LW_WORLD_CELL_UNLOADED;
+                
+                TraceLog(
+                    LOG_INFO, 
+                    "LOWEL: [WORLD '%s'] Unloaded map at (%d, %d)",
+                    world->name,
+                    x,
+                    y
+                );
+            }
+        }
+    }
+}
+
+/* 월드 기준 위치 `position`을 기준으로, 주변의 게임 맵을 경계 없이 이어서 화면에 그린다. */
+void DrawWorld(LwWorld *world, Vector2 position) {
+    LwMap *maps[9];
+    LwMap *map;
+    
+    Vector2 origins[9], local_positions[9];
+    Vector2 origin, local_position;
+    
+    double margin_x, margin_y;
+    
+    int center_x, center_y, map_count = 0;
+    
+    center_x = (int) floor(position.x / world->map_width);
+    center_y = (int) floor(position.y / world->map_height);
+    
+    /* 
+        그릴 범위가 게임 맵 하나보다 작다고 가정하면, 플레이어가 있는 칸과 그 주변 8칸만 확인하면 된다. 
+        그릴 범위가 게임 맵의 경계를 넘어가면, 가장 가까운 가장자리의 청크부터 그릴 수 있도록 위치를 
+        게임 맵 안쪽으로 옮긴다.
+    */
+    for (int dy = -1; dy <= 1; dy++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            if ((map = GetWorldMap(world, center_x + dx, center_y + dy)) == NULL)
+                continue;
+            
+            origin = GetWorldMapOrigin(world, center_x + dx, center_y + dy);
+            
+            local_position = (Vector2) { position.x - origin.x, position.y - origin.y };
+            
+            margin_x = (map->draw_distance + 1) * map->chunk_width * map->tile_width;
+            margin_y = (map->draw_distance + 1) * map->chunk_height * map->tile_height;
+            
+            if (local_position.x < -margin_x || local_position.x > map->width.px + margin_x
+                || local_position.y < -margin_y || local_position.y > map->height.px + margin_y)
+                continue;
+            
+            local_position.x = LW_MIN(LW_MAX(local_position.x, 0), map->width.px - 1);
+            local_position.y = LW_MIN(LW_MAX(local_position.y, 0), map->height.px - 1);
+            
+            maps[map_count] = map;
+            origins[map_count] = origin;
+            local_positions[map_count] = local_position;
+            
+            map_count++;
+        }
+    }
+    
+    /* 게임 맵의 경계에 걸친 개체도 올바른 순서로 그려지도록, 레이어 단위로 번갈아 그린다. */
+    for (int i = 0; i < MAX_LAYER_COUNT; i++) {
+        for (int j = 0; j < map_count; j++) {
+            rlPushMatrix();
+            
+            rlTranslatef(origins[j].x, origins[j].y, 0.0f);
+            
+            DrawMapLayer(maps[j], i, local_positions[j], 1.0f);
+            
+            rlPopMatrix();
+        }
+    }
+}
+
+/* 격자 좌표가 `(x, y)`인 칸의 게임 맵을 반환한다. 아직 불러오지 않은 게임 맵이라면 `NULL`을 반환한다. */
+LwMap *GetWorldMap(LwWorld *world, int x, int y) {
+    LwWorldCell *cell;
+    
+    if (world->_cells == NULL || x < 0 || x > world->width - 1 || y < 0 || y > world->height - 1)
+        return NULL;
+    
+    cell = &world->_cells[(y * world->width) + x];
+    
+    return (cell->state == LW_WORLD_CELL_READY) ? &cell->map : NULL;
+}
+
+/* 격자 좌표가 `(x, y)`인 칸의 게임 맵이 시작되는 월드 기준 위치를 반환한다. */
+Vector2 GetWorldMapOrigin(LwWorld *world, int x, int y) {
+    return (Vector2) { x * world->map_width, y * world->map_height };
+}